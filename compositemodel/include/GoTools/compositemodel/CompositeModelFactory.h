@@ -193,12 +193,30 @@ class GO_API CompositeModelFactory
   /// Create line segment bewteen the two points startpt and endpt
   CompositeCurve* createLineSegment(Point startpt, Point endpt);
 
+  /// Information about the repair of one trimmed surface read from file
+  struct TrimRepairInfo
+  {
+    int entity_ix;      // Index of the entity in the file
+    double time;        // Time used in seconds
+    bool trim_failure;  // Fixing of trimming curves failed
+    bool loop_failure;  // Check of loop orientation failed
+    bool turned_loop;   // A boundary loop was turned
+  };
+
+  /// Repair information for the trimmed surfaces of the latest file read,
+  /// in the order of the entities in the file
+  const std::vector<TrimRepairInfo>& trimRepairInfo() const
+  {
+    return trim_repair_info_;
+  }
+
  private:
   double approxtol_;
   double gap_;        // Gap between adjacent surfaces
   double neighbour_;  // Threshold for whether surfaces are adjacent
   double kink_;       // Kink between adjacent surfaces 
   double bend_;       // Intended G1 discontinuity between adjacent surfaces
+  std::vector<TrimRepairInfo> trim_repair_info_;
 
   // Read geometry from file converter
   CompositeModel* getGeometry(IGESconverter& conv, bool use_filetol,
@@ -213,6 +231,11 @@ class GO_API CompositeModelFactory
 				   std::vector<double> knots2, vector<Point> coefs);
 
   void replaceElementaryCurves(shared_ptr<CurveOnSurface> sf_cv);
+
+  // Repair one trimmed surface and split it if it is closed
+  void repairBoundedSurface(shared_ptr<BoundedSurface> gosf, int entity_ix,
+			    TrimRepairInfo& info,
+			    std::vector<shared_ptr<ParamSurface> >& sfs);
 };
 
 } // namespace Go
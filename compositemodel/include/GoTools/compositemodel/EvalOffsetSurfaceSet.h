@@ -110,6 +110,11 @@ namespace Go
         virtual bool approximationOK(double par_u, double par_v, Point approxpos,
                                      double tol1, double tol2) const;
 
+        /// A copy is made if the base surface is a single face. The chart
+        /// surface projects onto the faces of a surface set and is not
+        /// copied, 0 is returned.
+        virtual EvalSurface* threadCopy() const;
+
 #if 0
         // Debug
         virtual void write(std::ostream& out) const;
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _FACEBOXHIERARCHY_H
+#define _FACEBOXHIERARCHY_H
+
+#include "GoTools/compositemodel/ftPoint.h"
+#include "GoTools/utils/Point.h"
+#include <vector>
+
+namespace Go
+{
+
+class ftFaceBase;
+class ftSurface;
+class ParamSurface;
+class SplineSurface;
+class CurveBoundedDomain;
+
+/// Used internally in SurfaceModel. FaceBoxHierarchy stores the bounding
+/// boxes of the faces of a surface model in a binary tree (bounding volume
+/// hierarchy) and, for spline based faces, the bounding boxes of the control
+/// polygons of a number of sub patches. It is used to compute intersections
+/// between a surface model and a large number of rays. All query functions
+/// are const and may be called concurrently: the spline surfaces are
+/// evaluated without the knot interval cache of BsplineBasis, and the
+/// trimming test and the general line intersection are serialized.
+class FaceBoxHierarchy
+{
+ public:
+    /// Constructor
+    /// \param faces the faces of the surface model
+    /// \param tol geometry tolerance
+    /// \param max_sub maximum number of sub patches in each parameter
+    /// direction of one face
+    FaceBoxHierarchy(const std::vector<shared_ptr<ftFaceBase> >& faces,
+		     double tol, int max_sub = 8);
+
+    /// Number of faces
+    int numFaces() const
+    {
+      return (int)faces_.size();
+    }
+
+    /// Intersect a line with the faces. Only intersections with a signed
+    /// distance to 'pnt' in the interval [tmin, tmax] along the normalized
+    /// direction are returned. The intersections are sorted with respect to
+    /// this distance which is returned as the second element of each pair.
+    /// \param pnt point on the line
+    /// \param dir line direction, need not be normalized
+    /// \param tmin start of distance interval
+    /// \param tmax end of distance interval
+    /// \param first_only if true, at most the intersection closest to tmin
+    /// is returned
+    /// \retval result intersection points with corresponding distances
+    /// \return false if an intersection curve was found or the line is
+    /// tangential to a face at an intersection point, true otherwise
+    bool intersect(const Point& pnt, const Point& dir,
+		   double tmin, double tmax, bool first_only,
+		   std::vector<std::pair<ftPoint, double> >& result) const;
+
+ private:
+    struct Node
+    {
+      double box_[6];  // xmin, ymin, zmin, xmax, ymax, zmax
+      int left_;       // Children. -1 for leaves
+      int right_;
+      int first_;      // First entry in face_order_
+      int nmb_;        // Number of faces
+    };
+
+    struct SubPatch
+    {
+      double box_[6];
+      double dom_[4];  // umin, umax, vmin, vmax
+    };
+
+    std::vector<ftSurface*> faces_;
+    // Spline surface used for the Newton iteration, the untrimmed surface
+    // for trimmed faces. Null if the face is handled by the general
+    // intersection function
+    std::vector<SplineSurface*> spline_;
+    std::vector<const CurveBoundedDomain*> bdomain_;
+    std::vector<double> face_box_;
+    std::vector<int> sub_start_;
+    std::vector<SubPatch> sub_;
+    std::vector<int> face_order_;
+    std::vector<Node> nodes_;
+    double tol_;
+
+    void makeSubPatches(int idx, int max_sub);
+
+    int buildNode(int first, int nmb);
+
+    bool intersectFace(int idx, const Point& pnt, const Point& dir,
+		       const Point& e1, const Point& e2,
+		       double tmin, double tmax,
+		       std::vector<std::pair<ftPoint, double> >& result) const;
+
+    // Iterate to the intersection between the line and the spline surface
+    // of face idx inside a sub patch. ileft holds the knot interval hints
+    // of the calling thread
+    bool newton(int idx, const SubPatch& sub, const Point& pnt,
+		const Point& e1, const Point& e2, int ileft[],
+		double par[]) const;
+};
+
+} // namespace Go
+
+#endif // _FACEBOXHIERARCHY_H
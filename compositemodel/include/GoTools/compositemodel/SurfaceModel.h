@@ -44,6 +44,7 @@
 #include "GoTools/compositemodel/ftSurface.h"
 #include "GoTools/compositemodel/ftFaceBase.h"
 #include "GoTools/compositemodel/CellDivision.h"
+#include "GoTools/compositemodel/FaceBoxHierarchy.h"
 //#include "GoTools/topology/tpTopologyTable.h"
 #include "GoTools/compositemodel/ftCurve.h"
 #include "GoTools/compositemodel/ftPoint.h"
@@ -57,6 +58,7 @@
 #include "GoTools/compositemodel/ftLine.h"
 #include "GoTools/compositemodel/FaceUtilities.h"
 #include <vector>
+#include <unordered_map>
 
 namespace Go
 {
@@ -214,7 +216,8 @@ class GO_API SurfaceModel : public CompositeModel
   /// \return Whether or not it exists
   bool hasFace(ftSurface* face) const;
 
-  /// Given a face in the surface model, return the index of this face
+  /// Given a face in the surface model, return the index of this face.
+  /// The lookup takes constant time unless the face is not found
   /// \param face Shared pointer to face
   /// \return Index to face
   int getIndex(shared_ptr<ftSurface> face) const;
@@ -242,6 +245,9 @@ class GO_API SurfaceModel : public CompositeModel
   /// Creates the CellDivision object
   void initializeCelldiv();
 
+  /// Creates the face bounding box hierarchy used in ray casting
+  void initializeFaceTree();
+
   /// Return a cell in the cell division
   /// \param i Index of cell
   /// \return The cell
@@ -397,6 +403,28 @@ class GO_API SurfaceModel : public CompositeModel
   /// \return Whether the line hits or not.
   bool hit(const Point& point, const Point& dir, ftPoint& result);
 
+  /// Test if a number of half lines hit this surface model. Each half line
+  /// starts in a point and has a given direction. The faces are traversed
+  /// using a bounding box hierarchy, and the lines are processed in parallel
+  /// if OpenMP is enabled.
+  /// \param points Start points of the half lines.
+  /// \param dirs Line directions, one for each point.
+  /// \retval hit_found For each half line, 1 if it hits the model and 0 otherwise.
+  /// \retval result For each half line, the intersection point closest to the
+  ///                start point if any.
+  void hit(const std::vector<Point>& points, const std::vector<Point>& dirs,
+	   std::vector<int>& hit_found, std::vector<ftPoint>& result);
+
+  /// Compute all intersections between a number of half lines and this
+  /// surface model. Parallel version of hit() returning all intersection
+  /// points.
+  /// \param points Start points of the half lines.
+  /// \param dirs Line directions, one for each point.
+  /// \retval result For each half line, the intersection points sorted by
+  ///                increasing distance from the start point.
+  void allHits(const std::vector<Point>& points, const std::vector<Point>& dirs,
+	       std::vector<std::vector<ftPoint> >& result);
+
 /*   /// The two surface models are intersected and this model is trimmed with respect to the  */
 /*   /// intersection result.  */
 /*   void booleanIntersect(shared_ptr<SurfaceModel>, // The other model */
@@ -408,6 +436,18 @@ class GO_API SurfaceModel : public CompositeModel
   */
   ftCurve intersect(const ftPlane& plane);
 
+  /** Intersect the surface model with a family of parallel planes.
+      The plane with index i is given by normal*x = offsets[i], where
+      the normal is normalized. Each face is only intersected with the
+      planes within its extent along the normal.
+      \param normal Common normal of the planes.
+      \param offsets Plane positions along the normal, sorted in 
+      increasing order.
+      \return Intersection curve for each plane.
+  */
+  std::vector<ftCurve> intersectPlanes(const Point& normal,
+				       const std::vector<double>& offsets);
+
   /** Intersect the model with a plane and trim this model with respect to the
       plane, the part of the model at the positive side of the plane is removed.
       \param plane The plane.
@@ -865,6 +905,17 @@ class GO_API SurfaceModel : public CompositeModel
   /// Inside test, uses normal direction for open shell
   bool isInside(const Point& pnt, double& dist);
 
+  /// Inside test for a number of points. For a closed shell, the number of
+  /// intersections between the shell and a line through the point is counted
+  /// on either side of the point, and the points are processed in parallel
+  /// if OpenMP is enabled. Points where no line gives a consistent count,
+  /// and all points for open shells or bodies with more than one shell, are
+  /// classified with isInside(pnt, dist).
+  /// \param pnts Points to test.
+  /// \retval inside For each point, 1 if it lies inside or on the shell and
+  ///                0 otherwise.
+  void isInside(const std::vector<Point>& pnts, std::vector<int>& inside);
+
   /// Debug. Check topology
   bool checkShellTopology();
 
@@ -888,6 +939,10 @@ class GO_API SurfaceModel : public CompositeModel
 
   shared_ptr<CellDivision> celldiv_ ;   // To gain speedup in closest point and intersections
   mutable std::vector<bool> face_checked_;
+  shared_ptr<FaceBoxHierarchy> face_tree_;  // Used in ray casting
+  // Lookup tables used in getIndex(), updated when the face set changes
+  std::unordered_map<const ftFaceBase*, int> face_index_;
+  std::unordered_map<const ParamSurface*, int> surf_index_;
   //  mutable BoundingBox big_box_;
   BoundingBox limit_box_;
 
@@ -913,6 +968,10 @@ class GO_API SurfaceModel : public CompositeModel
 		      std::vector<std::pair<double,double> >& crv_bound,
 		      bool compute_curves=true) const;
 
+  int faceIndex(ftFaceBase* face) const;
+
+  void updateIndex();
+
   ftPoint closestPointLocal(const ftPoint& point) const;
 
   void localExtreme(ftSurface *face, Point& dir, 
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+
+#ifndef _FTHALFEDGEMESH_H
+#define _FTHALFEDGEMESH_H
+
+#include "GoTools/utils/config.h"
+#include "GoTools/parametrization/PrOrganizedPoints.h"
+#include <vector>
+
+namespace Go
+{
+
+class ftPointSet;
+class GenericTriMesh;
+
+//===========================================================================
+/** ftHalfEdgeMesh - Compact, index based half-edge representation of a
+ * triangulation
+ *
+ * Vertices, half-edges and triangles are stored in contiguous arrays. The
+ * half-edges of triangle t have index 3t, 3t+1 and 3t+2, and half-edge
+ * 3t+k runs from vertex k to vertex k+1 (modulo 3) of the triangle. 
+ * Twin half-edges are linked by index, a half-edge at the boundary of
+ * the mesh has no twin.
+ * The mesh implements the PrOrganizedPoints interface, and can replace
+ * the point set it was created from in the parametrization.
+ */
+//===========================================================================
+class GO_API ftHalfEdgeMesh : public PrOrganizedPoints
+{
+public:
+    /// Empty constructor
+    ftHalfEdgeMesh();
+
+    /// Construct the mesh from the connectivity graph of a point set.
+    /// The vertex indices correspond to the point indices in the set.
+    explicit ftHalfEdgeMesh(const ftPointSet& points);
+
+    /// Construct the mesh from vertex positions and triangles
+    /// \param xyz vertex positions, 3 entries per vertex
+    /// \param triangles vertex indices, 3 entries per triangle
+    ftHalfEdgeMesh(const std::vector<double>& xyz, 
+		   const std::vector<int>& triangles);
+
+    /// Construct the mesh from vertex positions, parameter values and
+    /// triangles
+    /// \param xyz vertex positions, 3 entries per vertex
+    /// \param uv vertex parameter values, 2 entries per vertex. May be
+    /// empty, in which case all parameter values are zero
+    /// \param triangles vertex indices, 3 entries per triangle
+    ftHalfEdgeMesh(const std::vector<double>& xyz, 
+		   const std::vector<double>& uv,
+		   const std::vector<int>& triangles);
+
+    /// Destructor
+    virtual ~ftHalfEdgeMesh();
+
+    /// Number of vertices
+    int numVertices() const
+    { return (int)xyz_.size()/3; }
+
+    /// Number of triangles
+    int numTriangles() const
+    { return (int)he_vert_.size()/3; }
+
+    /// Number of half-edges
+    int numHalfEdges() const
+    { return (int)he_vert_.size(); }
+
+    /// Position of vertex number i
+    const double* vertex(int i) const
+    { return &xyz_[3*i]; }
+
+    /// Parameter value of vertex number i
+    const double* parameter(int i) const
+    { return &uv_[2*i]; }
+
+    /// Boundary information of vertex number i as given by the point
+    /// set. 0: inner point, 1: boundary point, 2: boundary point on
+    /// sub surface
+    int boundaryInfo(int i) const
+    { return bd_[i]; }
+
+    /// Vertex from which the half-edge starts
+    int origin(int he) const
+    { return he_vert_[he]; }
+
+    /// Vertex in which the half-edge ends
+    int destination(int he) const
+    { return he_vert_[next(he)]; }
+
+    /// Next half-edge in the same triangle
+    int next(int he) const
+    { return (he % 3 == 2) ? he - 2 : he + 1; }
+
+    /// Previous half-edge in the same triangle
+    int prev(int he) const
+    { return (he % 3 == 0) ? he + 2 : he - 1; }
+
+    /// Opposite half-edge in the neighbouring triangle, -1 at the
+    /// boundary and at non-manifold edges
+    int twin(int he) const
+    { return he_twin_[he]; }
+
+    /// Triangle containing the half-edge
+    int triangle(int he) const
+    { return he/3; }
+
+    /// One half-edge starting in the vertex, -1 if the vertex is not
+    /// part of any triangle. For vertices at the mesh boundary, this
+    /// is the half-edge along the boundary.
+    int vertexHalfEdge(int i) const
+    { return vert_he_[i]; }
+
+    /// Check if the vertex lies at the boundary of the mesh
+    bool isBoundaryVertex(int i) const
+    { return (vert_he_[i] >= 0 && he_twin_[vert_he_[i]] < 0); }
+
+    /// Fetch the neighbours of a vertex in counter clockwise sequence
+    /// with regard to the triangle orientation. The mesh must be
+    /// consistently oriented and manifold around the vertex.
+    void getVertexNeighbours(int i, std::vector<int>& neighbours) const;
+
+    /// Orient the triangles consistently, starting from the first
+    /// triangle in each connected component. 
+    /// \return false if the mesh is not orientable
+    bool orientTriangles();
+
+    /// Reverse the orientation of a triangle
+    void flipTriangle(int t);
+
+    /// Reverse the orientation of all triangles
+    void reverseOrientation();
+
+    /// Fetch the vertex indices of all triangles
+    void getTriangles(std::vector<std::vector<int> >& triangles) const;
+
+    /// Export the mesh for visualization. Boundary vertices are those
+    /// marked as boundary points in the point set and those at the
+    /// boundary of the mesh. The caller is responsible for deleting
+    /// the returned mesh
+    /// \param use_normals compute area weighted vertex normals
+    GenericTriMesh* createGenericTriMesh(bool use_normals = true) const;
+
+    // From PrOrganizedPoints:
+    /// Number of vertices
+    virtual int getNumNodes() const
+    { return numVertices(); }
+    /// Position of vertex number i
+    virtual Vector3D get3dNode(int i) const
+    { return Vector3D(xyz_[3*i], xyz_[3*i+1], xyz_[3*i+2]); }
+    /// Change the position of vertex number i
+    virtual void set3dNode(int i, const Vector3D& p);
+    /// Fetch the neighbours of vertex number i, see getVertexNeighbours
+    virtual void getNeighbours(int i, std::vector<int>& neighbours) const
+    { getVertexNeighbours(i, neighbours); }
+    /// Check if vertex number i lies at the boundary
+    virtual bool isBoundary(int i) const
+    { return (bd_[i] == 1 || isBoundaryVertex(i)); }
+
+    /// Fetch 1. parameter of vertex number i
+    virtual double getU(int i) const
+    { return uv_[2*i]; }
+    /// Fetch 2. parameter of vertex number i
+    virtual double getV(int i) const
+    { return uv_[2*i+1]; }
+    /// Set 1. parameter of vertex number i
+    virtual void setU(int i, double u)
+    { uv_[2*i] = u; }
+    /// Set 2. parameter of vertex number i
+    virtual void setV(int i, double v)
+    { uv_[2*i+1] = v; }
+
+private:
+    std::vector<double> xyz_;
+    std::vector<double> uv_;
+    std::vector<int> bd_;       // Boundary information of each vertex
+    std::vector<int> he_vert_;  // Origin vertex of each half-edge
+    std::vector<int> he_twin_;  // Opposite half-edge or -1
+    std::vector<int> vert_he_;  // Outgoing half-edge of each vertex
+
+    void buildConnectivity();
+    void setVertexHalfEdges();
+};
+
+} // namespace Go
+
+#endif // _FTHALFEDGEMESH_H
@@ -54,6 +54,7 @@ namespace Go
 {
 
 class ftSamplePoint;
+ class ftHalfEdgeMesh;
  class ftFaceBase;
  class ftEdgeBase;
  class ftSurfaceSetPoint;
@@ -297,7 +298,23 @@ public:
     /// Fetch all triangles in the connectivity graph and make sure that the 
     /// triangle orientation is consistent, i.e. opposite directions of edges 
     /// between the same two nodes
-    void getOrientedTriangles(std::vector<std::vector<int> >& triangles);
+    /// \return false if the triangles can not be oriented consistently
+    bool getOrientedTriangles(std::vector<std::vector<int> >& triangles);
+
+    /// Create a compact half-edge representation of the triangulation to
+    /// be used in the parametrization instead of the point set. The
+    /// triangles are oriented such that the boundary runs counter
+    /// clockwise from the first to the second boundary point. The
+    /// parameter values computed on the mesh are transferred back with
+    /// setParameters().
+    /// \return an empty pointer if the triangles do not reproduce the
+    /// connectivity graph, i.e. if the graph is not a consistently
+    /// oriented, manifold triangulation
+    shared_ptr<ftHalfEdgeMesh> createHalfEdgeMesh() const;
+
+    /// Copy the parameter values of all vertices of a mesh created by
+    /// createHalfEdgeMesh() to the corresponding points
+    void setParameters(const ftHalfEdgeMesh& mesh);
 
      /// Write point set to stream
     void write(std::ostream& os) const;
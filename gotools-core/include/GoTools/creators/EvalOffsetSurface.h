@@ -97,6 +97,9 @@ namespace Go
         virtual bool approximationOK(double par_u, double par_v, Point approxpos,
                                      double tol1, double tol2) const;
 
+        /// The copy evaluates copies of the base surface.
+        virtual EvalSurface* threadCopy() const;
+
 
     private:
 
@@ -105,6 +105,26 @@ public:
   virtual bool approximationOK(double par_u, double par_v, Point approxpos,
 			       double tol1, double tol2) const = 0;
 
+  /// Query whether eval() and approximationOK() may be called concurrently
+  /// from several threads. If so, the Hermite approximation evaluates grid
+  /// nodes and tests segments in parallel (when compiled with OpenMP).
+  /// Default is false.
+  /// \return 'true' if the evaluation is reentrant
+  virtual bool threadSafeEval() const
+  {
+    return false;
+  }
+
+  /// Make an independent copy of the evaluator, sharing no state with
+  /// this one. An evaluator which is not reentrant may then be evaluated
+  /// in parallel, each thread using its own copy. Default is no copy.
+  /// \return the new evaluator (owned by the caller), or 0 if the
+  ///         evaluator can not be copied.
+  virtual EvalSurface* threadCopy() const
+  {
+    return 0;
+  }
+
   /// Closest point using general algorithm
   void closestPoint(const Point& pt,
 		    double&        clo_u,
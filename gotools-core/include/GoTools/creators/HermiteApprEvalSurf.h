@@ -111,6 +111,10 @@ public:
     const double tol2_; // Used by surface_ in approximationOK().
     double min_interval_;	// Smaller intervals are not refined
     HermiteGrid2D grid_;
+    // Copies of surface_ used by the other threads when surface_ is not
+    // reentrant, thread_sf_[ki] is used by thread ki+1. Empty if the
+    // evaluator is not copied.
+    std::vector<shared_ptr<EvalSurface> > thread_sf_;
 //     shared_ptr<SplineSurface> surface_approx_; // Spline representation of approximation
     
 #if 1
@@ -139,6 +143,9 @@ public:
 
     int splitDomain(double spar1, double epar1, double spar2, double epar2, Point bezcoef[16],
                     bool& dir_is_u, double& new_knot);
+
+    // Make copies of surface_ for parallel evaluation.
+    void makeThreadCopies();
     
 };
 
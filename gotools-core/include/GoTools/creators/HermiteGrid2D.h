@@ -85,6 +85,16 @@ public:
     /// \param crv curve to evaluate
     /// \param knot the new sample value (parameter value, knot)
     int addKnot(const EvalSurface& sf, double knot, bool dir_is_u);
+
+    /// As above, but with copies of the evaluator to be used by the other
+    /// threads when the new nodes are evaluated in parallel. Thread number
+    /// ki+1 evaluates thread_sf[ki], see EvalSurface::threadCopy().
+    /// \param sf surface to evaluate
+    /// \param thread_sf copies of sf
+    /// \param knot the new sample value (parameter value, knot)
+    int addKnot(const EvalSurface& sf,
+                const std::vector<shared_ptr<EvalSurface> >& thread_sf,
+                double knot, bool dir_is_u);
   
     /// Calculate Bezier coefficients of the cubic curve interpolating 
     /// the point and tangent values at grid nodes with indices "left" 
@@ -144,6 +154,17 @@ private:
     
     int getPosition(double knot, bool dir_is_u);
 
+    // Evaluate all nodes of the grid given by knots_u_ and knots_v_.
+    void evalGrid(const EvalSurface& sf);
+
+    // Evaluate the nodes (par_u[ki], par_v[ki]), in parallel if the
+    // evaluator is reentrant or copies for the other threads are given.
+    void evalNodes(const EvalSurface& sf,
+                   const std::vector<shared_ptr<EvalSurface> >& thread_sf,
+                   const std::vector<double>& par_u,
+                   const std::vector<double>& par_v,
+                   std::vector<Point>& data) const;
+
 };
 
 } // namespace Go
@@ -213,10 +213,22 @@ protected:
     std::vector<double> coef_array_; // Only used if copy_coefs_ == true
     std::vector<double>::iterator scoef_;   // Pointer to surface coefficients.      
 
-    /// Storage of the equation system.
-    std::vector<double> gmat_;         // Matrix at left side of equation system.  
+    /// Storage of the equation system. The matrix at the left side is
+    /// sparse and stored row by row. The column indices of each row are
+    /// sorted, and gmat_[ki][kj] is the entry in column gmat_col_[ki][kj].
+    std::vector<std::vector<int> > gmat_col_;  // Column indices of non-zero entries.
+    std::vector<std::vector<double> > gmat_;   // Matrix at left side of equation system.  
     std::vector<double> gright_;       // Right side of equation system.      
 
+    /// Add a value to an entry in the matrix at the left side of the
+    /// equation system. The entry is created if it does not exist.
+    void addToMatrix(int row, int col, double val);
+
+    /// Create the entries of the matrix at the left side of the equation
+    /// system corresponding to pairs of free coefficients with overlapping
+    /// support. These entries may be updated concurrently.
+    void prepareMatrix();
+
     ///   Free all memory allocated for class members.
     virtual
     void releaseScratch(); 
@@ -299,6 +311,9 @@ private:
     // of derivatives of B-splines in 1. par. dir.  
     double ***integral2_;  // Array used to store integrals of inner product
     // of derivatives of B-splines in 2. par. dir.  
+    BsplineBasis integral_basis1_;  // The spline spaces and number of 
+    BsplineBasis integral_basis2_;  // derivatives for which the integrals
+    int integral_der_;              // are computed.
 
     double omega_;
 
@@ -79,6 +79,17 @@ public:
     /// \param nn the number of unknowns in the system.
     void attachMatrix(double *gmat, int nn);
 
+    /// Attach the left side of the equation system given as a sparse
+    /// matrix in compressed row format. The content of the input arrays
+    /// is moved to the current object, i.e. the arrays are emptied.
+    /// \param irow the indexes in gmat and jcol of the first non-zeros
+    ///             of each row. Size is nn+1.
+    /// \param jcol the column indexes of the non-zero elements.
+    /// \param gmat the non-zero elements of the system matrix.
+    /// \param nn the number of unknowns in the system.
+    void attachMatrix(std::vector<int>& irow, std::vector<int>& jcol,
+		      std::vector<double>& gmat, int nn);
+
     /// Prepare for preconditioning.
     /// \param relaxfac relaxation parameter. Range: [0,0, 1.0].
     virtual void precondRILU(double relaxfac);
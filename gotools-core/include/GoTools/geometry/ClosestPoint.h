@@ -272,6 +272,59 @@ closestPtSurfSurfPlaneFunctional(const std::vector<Point>& epoint, //plane descr
 				 std::vector<Point>& gpnt2, // result of iter. in surf. 2
 				 Point& gpar1, Point& gpar2, int& jstat); // results of param.
 
+
+  /** Closest point computations for one point, used by 
+   * \ref closestPointSequence(). The parameter values of a closest point
+   * are stored in an array of length numPar().
+   */
+  class SequenceProjector
+  {
+  public:
+    /// Destructor
+    virtual ~SequenceProjector() {}
+
+    /// Number of parameter values of a closest point
+    virtual int numPar() const = 0;
+
+    /// Compute the closest point by a global search
+    /// \param pt the point
+    /// \retval par parameter values of the closest point
+    /// \retval clo_pt the closest point
+    /// \retval clo_dist the distance between 'pt' and 'clo_pt'
+    virtual void global(const Point& pt, double par[], Point& clo_pt,
+			double& clo_dist) = 0;
+
+    /// Compute the closest point by an iteration starting from the
+    /// parameter values given in 'par'
+    /// \param pt the point
+    /// \param par start parameter values on input, parameter values of
+    ///        the closest point on output
+    /// \retval clo_pt the closest point
+    /// \retval clo_dist the distance between 'pt' and 'clo_pt'
+    virtual void seeded(const Point& pt, double par[], Point& clo_pt,
+			double& clo_dist) = 0;
+  };
+
+  /** Compute the closest points of an ordered sequence of nearby points.
+   * Each point is projected using the result of the previous point as
+   * seed. The previous closest point bounds the distance from the current
+   * point to the geometry object, and if the seeded result does not
+   * respect this bound the sequence has jumped, and a global search is made
+   * for this point. Common implementation of closestPointSequence() in
+   * the curve and surface classes.
+   * \param pts the ordered sequence of points
+   * \param proj closest point computations for the geometry object
+   * \retval clo_par parameter values of the closest points, numPar()
+   *         values for each point
+   * \retval clo_pt the closest points
+   * \retval clo_dist distances between the points and their closest points
+   */
+  void closestPointSequence(const std::vector<Point>& pts,
+			    SequenceProjector& proj,
+			    std::vector<double>& clo_par,
+			    std::vector<Point>& clo_pt,
+			    std::vector<double>& clo_dist);
+
 } // namespace ClosestPoint
 
 } // namespace Go
@@ -190,19 +190,7 @@ namespace Go
 	/// \param pt the result of the evaluation is written here 
 	/// \param upar the first parameter
 	/// \param vpar the second parameter
-	virtual void point(Point& pt, double upar, double vpar) const
-	{
-	    Point param(2);
-	    param[0] = upar;
-	    param[1] = vpar;
-	    Point param_next(2);
-	    int num_maps = (int)domain_maps_.size();
-	    for (int i = 0; i < num_maps; ++i) {
-		domain_maps_[i].point(param_next, param[0], param[1]);
-		param = param_next;
-	    }
-	    surf_.point(pt, param[0], param[1]);
-	}
+	virtual void point(Point& pt, double upar, double vpar) const;
 
 	/// Evaluates the surface's position and a certain number of derivatives
 	/// for a given parameter pair.
@@ -250,19 +238,42 @@ namespace Go
 	/// \param n the computed normal will be written to this variable
 	/// \param upar the first parameter
 	/// \param vpar the second parameter
-	virtual void normal(Point& n, double upar, double vpar) const
-	{
-	    Point param(2);
-	    param[0] = upar;
-	    param[1] = vpar;
-	    Point param_next(2);
-	    int num_maps = (int)domain_maps_.size();
-	    for (int i = 0; i < num_maps; ++i) {
-		domain_maps_[i].point(param_next, param[0], param[1]);
-		param = param_next;
-	    }
-	    surf_.normal(n, param[0], param[1]);
-	}
+	virtual void normal(Point& n, double upar, double vpar) const;
+
+	/// Map parameter pairs of this surface through the domain maps to
+	/// the parameter domain of the underlying spline surface.
+	/// \param params the parameter pairs, stored as (u0, v0, u1, v1, ...)
+	/// \param mapped upon return, the corresponding parameter pairs of
+	///               the underlying spline surface
+	void mapParameters(const std::vector<double>& params,
+			   std::vector<double>& mapped) const;
+
+	/// Evaluate the surface in a number of parameter pairs. Each
+	/// domain map is applied to all parameter pairs before the next
+	/// one, and large batches are evaluated in parallel when compiled
+	/// with OpenMP.
+	/// \param params the parameter pairs, stored as (u0, v0, u1, v1, ...)
+	/// \param points upon return, the evaluated points, dimension()
+	///               entries for each parameter pair
+	void evalPoints(const std::vector<double>& params,
+			std::vector<double>& points) const;
+
+	/// Evaluate the surface normal in a number of parameter pairs.
+	/// \see evalPoints()
+	/// \param params the parameter pairs, stored as (u0, v0, u1, v1, ...)
+	/// \param normals upon return, the normals, dimension() entries
+	///                for each parameter pair
+	void evalNormals(const std::vector<double>& params,
+			 std::vector<double>& normals) const;
+
+	/// Evaluate points in a grid. The first domain map is evaluated
+	/// by the grid evaluator of SplineSurface, the remaining maps and
+	/// the underlying surface as in evalPoints().
+	virtual void evalGrid(int num_u, int num_v, 
+			      double umin, double umax, 
+			      double vmin, double vmax,
+			      std::vector<double>& points,
+			      double nodata_val = -9999) const;
 
 	/// Get the curve(s) obtained by intersecting the surface with one of its constant
 	/// parameter curves.  For surfaces without holes, this will be the parameter curve
@@ -448,6 +459,13 @@ namespace Go
     private:
 	SplineSurface surf_;
 	std::vector<SplineSurface> domain_maps_;
+
+	// Map one parameter pair to the parameter domain of surf_
+	void mapParameter(double upar, double vpar, double par[]) const;
+
+	// Apply the domain maps from number first to a sequence of
+	// parameter pairs. The pairs are updated in place.
+	void mapSequence(int first, std::vector<double>& params) const;
     };
 
 
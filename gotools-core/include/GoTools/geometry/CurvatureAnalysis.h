@@ -43,6 +43,7 @@
 
 #include "GoTools/geometry/ParamSurface.h"
 #include "GoTools/utils/Point.h"
+#include <vector>
 
 /// \file CurvatureAnalysis.h
 /// Curvature analysis related to surfaces.
@@ -51,6 +52,8 @@
 namespace Go
 {
 
+class SplineSurface;
+
 /// Curvature analysis related to surfaces.
 /// Functions computing fundamental forms and curvature.
 namespace CurvatureAnalysis
@@ -111,6 +114,61 @@ namespace CurvatureAnalysis
 			     double& k1, Point& d1,
 			     double& k2, Point& d2);
 
+    /// Curvature information in a grid of parameter values. All values are
+    /// stored in flat arrays with one entry for each grid point, and the
+    /// first parameter running fastest, i.e. the entry of the point
+    /// (param_u[ki], param_v[kj]) is kj*param_u.size()+ki.
+    struct CurvatureMap
+    {
+	/// Parameter values in the first parameter direction
+	std::vector<double> param_u;
+	/// Parameter values in the second parameter direction
+	std::vector<double> param_v;
+	/// Gaussian curvature
+	std::vector<double> gauss;
+	/// Mean curvature
+	std::vector<double> mean;
+	/// Maximum principal curvature
+	std::vector<double> k1;
+	/// Minimum principal curvature
+	std::vector<double> k2;
+	/// Principal direction corresponding to k1 given in the parameter
+	/// domain, two entries for each grid point
+	std::vector<double> d1;
+	/// Principal direction corresponding to k2, two entries for each
+	/// grid point
+	std::vector<double> d2;
+	/// Minimum curvature radius, 1/max(|k1|,|k2|). MAXDOUBLE in flat points
+	std::vector<double> min_radius;
+    };
+
+    /// Computes curvature information in all points of the parameter grid
+    /// spanned by param_u and param_v. The result corresponds to calling
+    /// curvatures() and principalCurvatures() in each grid point. If the
+    /// surface is a spline surface (possibly trimmed), the B-spline basis
+    /// functions are evaluated once for each grid line, and the grid lines
+    /// are evaluated in parallel if OpenMP is enabled. Other surfaces, and
+    /// points where the spline surface is degenerate, are evaluated
+    /// sequentially.
+    /// \param sf the surface, must lie in 3D
+    /// \param param_u parameter values in the first parameter direction
+    /// \param param_v parameter values in the second parameter direction
+    /// \param curv_map the computed curvature information
+    void curvatureMap(const ParamSurface& sf,
+		      const std::vector<double>& param_u,
+		      const std::vector<double>& param_v,
+		      CurvatureMap& curv_map);
+
+    /// Computes curvature information in the Gauss points of all polynomial
+    /// patches of a spline surface. The number of Gauss points in each
+    /// patch and parameter direction is the one used in the integration
+    /// of spline spaces (GaussQuadValues()).
+    /// \param sf the surface, must lie in 3D
+    /// \param curv_map the computed curvature information, including the
+    ///                 Gauss point parameters
+    void curvatureMapGaussPoints(const SplineSurface& sf,
+				 CurvatureMap& curv_map);
+
     /// Estimate the minimum curvature radius of the surface sf. 
     /// \param sf the given surface
     /// \param tolerance influences the density of the search
@@ -89,6 +89,12 @@ public:
       return (int)loops_.size();
     }
 
+    /// Access one of the curve loops defining the domain
+    shared_ptr<CurveLoop> loop(int idx) const
+    {
+      return loops_[idx];
+    }
+
     /// Query whether a given parameter pair is inside the domain or
     /// not.
     /// \param point array containing the parameter pair
@@ -287,6 +287,26 @@ public:
     ///                 between 'pt' and the closest point found.
     void closestPoint(const Point& pt, double& clo_t, Point& clo_pt, double& clo_dist) const;
 
+    /// Compute the closest points on an interval of this curve for an
+    /// ordered sequence of nearby points, typically the vertices of a dense
+    /// polyline. Each point is projected using the result of the previous
+    /// point as seed. The previous closest point bounds the distance from
+    /// the current point to the curve, and if the seeded result does not
+    /// respect this bound the sequence has jumped, and a global search is
+    /// made for this point.
+    /// \param pts the ordered sequence of points
+    /// \param tmin start parameter of search interval
+    /// \param tmax end parameter of search interval
+    /// \param clo_t parameter values of the closest points, one per point
+    /// \param clo_pt the closest points
+    /// \param clo_dist distances between the points and their closest points
+    virtual void closestPointSequence(const std::vector<Point>& pts,
+				      double tmin,
+				      double tmax,
+				      std::vector<double>& clo_t,
+				      std::vector<Point>& clo_pt,
+				      std::vector<double>& clo_dist) const;
+
     /// If the ParamCurve is divided up into logical segments, this function will return 
     /// the parameter value of the "next segment", starting from a parameter given by the user.
     /// If no division into logical segments exist, then it is the start- or end parameter that
@@ -351,10 +371,10 @@ protected:
 			     Point&  clo_pt,
 			     double&   clo_dist) const;
 
-    void s1771(Point pt,double aepsge,
+    void s1771(const Point& pt,double aepsge,
 	       double astart,double aend,double anext,double &cpos,int *jstat) const;
 
-    void s1771_s9point(Point pt, std::vector<Point> val, Point diff,
+    void s1771_s9point(const Point& pt, std::vector<Point>& val, Point& diff,
 			  double astart,double aend,int max_it,double *cnext,double *ad,
 		       double adel,double *cdist,double aprev,int *jstat) const;
 
@@ -353,6 +353,30 @@ public:
 		      const RectDomain* domain_of_interest = NULL,
 		      double   *seed = 0) const;
 
+    /// Compute the closest points on the surface for an ordered sequence
+    /// of nearby points, typically the vertices of a dense polyline. Each
+    /// point is projected using the result of the previous point as seed.
+    /// The previous closest point bounds the distance from the current
+    /// point to the surface, and if the seeded result does not respect this
+    /// bound the sequence has jumped, and a global search is made for this
+    /// point.
+    /// \param pts the ordered sequence of points
+    /// \param clo_u u parameters of the closest points, one per point
+    /// \param clo_v v parameters of the closest points
+    /// \param clo_pt the closest points
+    /// \param clo_dist distances between the points and their closest points
+    /// \param epsilon parameter tolerance, see closestPoint()
+    /// \param domain_of_interest pointer to parameter domain in which to
+    ///        search for closest points. If a NULL pointer is used, the
+    ///        entire surface is searched.
+    virtual void closestPointSequence(const std::vector<Point>& pts,
+				      std::vector<double>& clo_u,
+				      std::vector<double>& clo_v,
+				      std::vector<Point>& clo_pt,
+				      std::vector<double>& clo_dist,
+				      double epsilon,
+				      const RectDomain* domain_of_interest = NULL) const;
+
     void singularity(double& sing_u,
 		     double& sing_v, 
 		     Point& sing_pt,
@@ -603,7 +627,7 @@ public:
 		      double astart1,double aend1,double astart2,double aend2) const;
     
     void s1773_s9dir(double *cdist,double *cdiff1,double *cdiff2,
-		     double PS[],const double *eval1,std::vector<Point> eval2,
+		     double PS[],const double *eval1,std::vector<Point>& eval2,
 		     double aepsge, int idim,int *jstat) const;
 
 
@@ -265,6 +265,38 @@ public:
 			      double&        clo_dist,
 			      double const   *seed = 0) const;
 
+    /// Local closest point iteration starting from a given parameter.
+    /// Intended for sequences of nearby points, where the result of the
+    /// previous query is a good start value. The iteration is a Newton
+    /// iteration on the derivative of the squared distance, safeguarded by
+    /// bisection, and no memory is allocated. The search for the knot
+    /// interval is started from 'knot_ix', which is updated on return.
+    /// Curves of very high order or dimension are handled by closestPoint().
+    /// \param pt the point to project
+    /// \param tmin start of the parameter interval to search
+    /// \param tmax end of the parameter interval to search
+    /// \param clo_t on input the start parameter, on output the parameter
+    ///              of the closest point
+    /// \param clo_pt the closest point
+    /// \param clo_dist the distance between 'pt' and 'clo_pt'
+    /// \param knot_ix knot interval hint, may be 0. Initialize to -1.
+    void closestPointLocal(const Point& pt,
+			   double         tmin,
+			   double         tmax,
+			   double&        clo_t,
+			   Point&         clo_pt,
+			   double&        clo_dist,
+			   int            *knot_ix = 0) const;
+
+    // Inherited from ParamCurve. Uses closestPointLocal() for the seeded
+    // iterations.
+    virtual void closestPointSequence(const std::vector<Point>& pts,
+				      double tmin,
+				      double tmax,
+				      std::vector<double>& clo_t,
+				      std::vector<Point>& clo_pt,
+				      std::vector<double>& clo_dist) const;
+
     /// Inherited from ParamCurve
     /// Compute the total length of this curve
     virtual double length(double tol);
@@ -559,6 +559,18 @@ class GO_API SplineSurface : public ParamSurface
 		double to_upar, double to_vpar,
 		double fuzzy = DEFAULT_PARAMETER_EPSILON) const;
 
+    /// Split the surface in two at a given parameter value. The split
+    /// knot is inserted once, and both pieces are picked from the
+    /// refined coefficients. This is cheaper than two calls to
+    /// subSurface().
+    /// \param param the parameter value in which to split
+    /// \param pardir 0 = split along the u-direction, 1 = v-direction
+    /// \param fuzzy tolerance used to snap 'param' to an existing knot
+    /// \return the two pieces, the one with the lowest parameter values first
+    std::vector<shared_ptr<SplineSurface> >
+    split(double param, int pardir,
+	  double fuzzy = DEFAULT_PARAMETER_EPSILON) const;
+
     /// Mirror a surface around a specified plane
     virtual SplineSurface* mirrorSurface(const Point& pos, const Point& norm) const;
 
@@ -572,6 +584,45 @@ class GO_API SplineSurface : public ParamSurface
 			      const RectDomain* domain_of_interest = NULL,
 			      double   *seed = 0) const;
 
+    /// Local closest point iteration starting from the given parameter
+    /// pair. Intended for sequences of nearby points, where the result of
+    /// the previous query is a good start value. The iteration is a Newton
+    /// iteration on the squared distance with a line search, and parameter
+    /// directions where the minimum lies outside the domain are kept fixed
+    /// at the boundary. No memory is allocated, and the search for the knot
+    /// intervals is started from 'knot_ix', which is updated on return.
+    /// Surfaces of very high order or dimension are handled by closestPoint().
+    /// \param pt the point to project
+    /// \param clo_u on input the start parameter, on output the u-parameter
+    ///              of the closest point
+    /// \param clo_v on input the start parameter, on output the v-parameter
+    ///              of the closest point
+    /// \param clo_pt the closest point
+    /// \param clo_dist the distance between 'pt' and 'clo_pt'
+    /// \param epsilon geometric tolerance, used if closestPoint() is called
+    /// \param domain_of_interest restrict the search to this domain, 0 for
+    ///        the entire surface
+    /// \param knot_ix knot interval hints in the two parameter directions,
+    ///        array of size 2 or 0. Initialize to -1.
+    void closestPointLocal(const Point& pt,
+			   double&        clo_u,
+			   double&        clo_v,
+			   Point&         clo_pt,
+			   double&        clo_dist,
+			   double         epsilon,
+			   const RectDomain* domain_of_interest = NULL,
+			   int            *knot_ix = 0) const;
+
+    // Inherited from ParamSurface. Uses closestPointLocal() for the seeded
+    // iterations.
+    virtual void closestPointSequence(const std::vector<Point>& pts,
+				      std::vector<double>& clo_u,
+				      std::vector<double>& clo_v,
+				      std::vector<Point>& clo_pt,
+				      std::vector<double>& clo_dist,
+				      double epsilon,
+				      const RectDomain* domain_of_interest = NULL) const;
+
     // inherited from ParamSurface
     virtual void closestBoundaryPoint(const Point& pt,
 				      double&        clo_u,
@@ -1579,7 +1630,7 @@ class GO_API SplineSurface : public ParamSurface
 		      double astart1,double aend1,double astart2,double aend2) const;
 
     void s1773_s9dir(double *cdist,double *cdiff1,double *cdiff2,
-		     double PS[],const double *eval1,std::vector<Point> eval2,
+		     double PS[],const double *eval1,std::vector<Point>& eval2,
 		     double aepsge, int idim,int *jstat) const;
 
 
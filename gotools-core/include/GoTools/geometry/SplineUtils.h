@@ -196,6 +196,36 @@ namespace SplineUtils {
     ///             as 'eder').
     void GO_API surface_ratder(double const eder[],int idim,int ider,double gder[]);
 
+    /// Locate the knot interval containing a parameter value, i.e. the index
+    /// ileft with et[ileft] <= t < et[ileft+1] and ik-1 <= ileft <= in-1.
+    /// At the end of the parameter interval the last non-empty interval is
+    /// returned. The search starts in the interval given by 'hint', which
+    /// makes the lookup O(1) for sequences of nearby parameter values. Unlike
+    /// BsplineBasis::knotIntervalFuzzy() no state is modified, so the function
+    /// may be called concurrently.
+    /// \param et the knot vector, of length in+ik
+    /// \param ik the order of the basis
+    /// \param in the number of basis functions
+    /// \param t the parameter value
+    /// \param hint a guess for the knot interval. Negative if unknown.
+    /// \return the index of the knot interval
+    int GO_API locate_knot_interval(const double* et, int ik, int in, double t,
+				    int hint);
+
+    /// Compute the values and the first 'ider' derivatives of the 'ik'
+    /// nonzero B-splines at 't', given the knot interval 'ileft' in which
+    /// 't' is located. No memory is allocated.
+    /// \param et the knot vector
+    /// \param ik the order of the basis
+    /// \param ileft the knot interval, as computed by locate_knot_interval()
+    /// \param t the parameter value
+    /// \param ider the number of derivatives
+    /// \param ebder output array of size ik*(ider+1). All values are stored
+    ///              first, then all first derivatives etc.
+    /// \param work scratch array of size ik*(ik+4)
+    void GO_API basis_derivs(const double* et, int ik, int ileft, double t,
+			     int ider, double* ebder, double* work);
+
     /// Corresponds to s1701 in SISL
     /// This function computes in a compact format a line in the discrete
     /// B-spline matrix converting between an orginal basis
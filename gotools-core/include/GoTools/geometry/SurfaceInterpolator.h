@@ -64,6 +64,30 @@ namespace Go
 					bool rational,
 					std::vector<double>& weights);
 
+    /// Least squares approximation of points given on a regular
+    /// parameter grid, for instance the output of
+    /// SplineSurface::gridEvaluator() or a height raster. As the
+    /// data lie on a grid, the problem separates into one dimensional
+    /// approximations in each parameter direction. All rows share the
+    /// same band structured normal equations, thus memory usage is
+    /// linear in the number of data points and the one dimensional
+    /// problems are solved in parallel if OpenMP is enabled.
+    /// The function throws if the input parameters are inconsistent.
+    /// \param basis_u the spline space in the first parameter direction
+    /// \param basis_v the spline space in the second parameter direction
+    /// \param par_u parameter values of the grid in the first direction
+    /// \param par_v parameter values of the grid in the second direction
+    /// \param points the data points, par_u.size()*par_v.size() points
+    ///               where the first parameter direction runs fastest
+    /// \param dimension the dimension of the data points
+    /// \return the approximating surface
+    SplineSurface* regularApproximation(const BsplineBasis& basis_u,
+					const BsplineBasis& basis_v,
+					const std::vector<double>& par_u,
+					const std::vector<double>& par_v,
+					const std::vector<double>& points,
+					int dimension);
+
   };    // namespace SurfaceInterpolator
 
 
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+
+#ifndef _BANDEDMATRIX_H
+#define _BANDEDMATRIX_H
+
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+/** Square matrix with a limited number of sub- and superdiagonals,
+ *  stored in compact row-wise form. Spline collocation matrices have
+ *  this structure since each interpolation condition only involves the
+ *  B-splines being nonzero at the parameter value. The matrix can be
+ *  LU decomposed with partial pivoting and used to solve systems with
+ *  several right hand sides at a cost of O(n*kl*(kl+ku)) instead of O(n^3).
+ */
+class GO_API BandedMatrix
+{
+public:
+    /// Constructor
+    /// \param num_rows number of rows (and columns) in the matrix
+    /// \param lower_bw number of subdiagonals (kl)
+    /// \param upper_bw number of superdiagonals (ku)
+    BandedMatrix(int num_rows, int lower_bw, int upper_bw);
+
+    /// Number of rows (and columns)
+    int numRows() const
+    {
+	return num_rows_;
+    }
+
+    /// Number of subdiagonals
+    int lowerBandwidth() const
+    {
+	return kl_;
+    }
+
+    /// Number of superdiagonals
+    int upperBandwidth() const
+    {
+	return ku_;
+    }
+
+    /// Check if the entry (i,j) is inside the band
+    bool inBand(int i, int j) const
+    {
+	return (j - i <= ku_ && i - j <= kl_);
+    }
+
+    /// Access an entry inside the band. Entries outside the band
+    /// are zero and must not be accessed.
+    double& operator()(int i, int j)
+    {
+	return data_[i*width_ + j - i + kl_];
+    }
+
+    /// Access an entry inside the band.
+    double operator()(int i, int j) const
+    {
+	return data_[i*width_ + j - i + kl_];
+    }
+
+    /// LU decompose the matrix using partial pivoting with implicit
+    /// row scaling. Throws if the matrix is singular.
+    void LUDecomp();
+
+    /// Solve the system A x = b for a decomposed matrix.
+    /// \param rhs At function invocation, rhs contains 'dim'
+    ///            right hand sides stored interleaved, i.e. entry i
+    ///            of right hand side d is stored in rhs[i*dim+d].
+    ///            On return the solutions are stored in the same way.
+    /// \param dim the number of right hand sides
+    void solve(double* rhs, int dim) const;
+
+private:
+    int num_rows_;
+    int kl_;
+    int ku_;
+    int width_;   // kl_ + ku_ + 1 + kl_ to allow for pivoting fill-in
+    std::vector<double> data_;
+    std::vector<int> pivot_;
+    bool decomposed_;
+};
+
+
+/** Symmetric positive definite band matrix where only the lower
+ *  triangle is stored. Typically the normal equations of a least
+ *  squares spline approximation, where the half bandwidth is the
+ *  spline order minus one. The matrix is Cholesky factorized.
+ */
+class GO_API SymBandedMatrix
+{
+public:
+    /// Constructor
+    /// \param num_rows number of rows (and columns) in the matrix
+    /// \param bw half bandwidth (number of subdiagonals)
+    SymBandedMatrix(int num_rows, int bw);
+
+    /// Number of rows (and columns)
+    int numRows() const
+    {
+	return num_rows_;
+    }
+
+    /// Half bandwidth
+    int bandwidth() const
+    {
+	return bw_;
+    }
+
+    /// Access an entry in the lower triangle, i.e. j <= i and i - j <= bw
+    double& operator()(int i, int j)
+    {
+	return data_[i*(bw_+1) + j - i + bw_];
+    }
+
+    /// Access an entry in the lower triangle
+    double operator()(int i, int j) const
+    {
+	return data_[i*(bw_+1) + j - i + bw_];
+    }
+
+    /// Cholesky factorize the matrix. 
+    /// \return false if the matrix is not numerically positive definite. 
+    /// The content of the matrix is then undefined.
+    bool choleskyDecomp();
+
+    /// Solve the system A x = b for a factorized matrix.
+    /// \param rhs right hand sides stored interleaved as in
+    ///            BandedMatrix::solve(). Overwritten by the solutions.
+    /// \param dim the number of right hand sides
+    void solve(double* rhs, int dim) const;
+
+    /// Copy the matrix into a general band matrix. Used as a fallback
+    /// if the Cholesky factorization fails. Must be called prior to
+    /// choleskyDecomp().
+    BandedMatrix toBandedMatrix() const;
+
+private:
+    int num_rows_;
+    int bw_;
+    std::vector<double> data_;
+    bool decomposed_;
+};
+
+} // namespace Go
+
+#endif // _BANDEDMATRIX_H
@@ -147,7 +147,7 @@ template <class T>
 inline Array<T, Dim+1>
 BaryCoordSystem<Dim>::cartToBary(const Array<T, Dim>& cart_pt) const
 {
-    static Array<T, Dim> subsimplex[Dim+1];
+    Array<T, Dim> subsimplex[Dim+1];
     for (int i = 1; i < Dim+1; ++i) {
 	for (int d = 0; d < Dim; ++d) {
 	    subsimplex[i][d] = T(corners_[i][d]);
@@ -139,6 +139,14 @@ namespace Go
 	  return inside_points_;
 	}
 
+      /// Write the surface and the preprocessed data to stream.
+      /// Surface copies are not written
+      void write(std::ostream& os) const;
+
+      /// Read the surface and the preprocessed data from stream, as
+      /// written by write()
+      void read(std::istream& is);
+
     private:
 
       /// The index of this surface in the surface list in the overall BoundingBoxStructure instance
@@ -319,6 +327,13 @@ namespace Go
 	polygon_v_.resize(0);
       }
 
+      /// Write the segment data to stream. The surface data is not written
+      void write(std::ostream& os) const;
+
+      /// Read the segment data from stream, as written by write().
+      /// The surface data must be given in the constructor
+      void read(std::istream& is);
+
     private:
 
       /// The structure data of the surface
@@ -398,6 +413,16 @@ namespace Go
 	return surfaces_[i];
       }
 
+      /// Write the entire structure, including the surfaces, to stream.
+      /// The structure may then be read back for later calculations
+      /// on the same surface model, avoiding a new preprocessing
+      void write(std::ostream& os) const;
+
+      /// Read a structure written by write(). Any existing content is
+      /// replaced. The surface classes must be registered in the
+      /// Factory, see GoTools::init()
+      void read(std::istream& is);
+
       /// Get the number of voxels in first coordinate direction
       int n_voxels_x() const
       {
@@ -549,7 +574,9 @@ namespace Go
   /// Create preprocessing data for the closest vector calculations on a surface.
   /// surfaces - a collection of the paramteric surfaces defining the surface model. Only instances of the ParamSurface subclass hierarchy are used
   /// par_len_el - a guiding for the side lengths of the segments in geometry space, used to determine the number of segments for elementary surfaces
-  /// returns the preprocessing structures used as input for the closest point calculations
+  /// returns the preprocessing structures used as input for the closest point calculations.
+  /// The structure may be kept and used for any number of calculations on the same surface model,
+  /// and saved with BoundingBoxStructure::write() for later runs
   shared_ptr<boxStructuring::BoundingBoxStructure> preProcessClosestVectors(const std::vector<shared_ptr<GeomObject> >& surfaces, double par_len_el);
 
 
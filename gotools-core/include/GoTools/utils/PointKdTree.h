@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _POINTKDTREE_H
+#define _POINTKDTREE_H
+
+#include "GoTools/utils/Point.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go {
+
+    /** Balanced k-d tree over a fixed point cloud, used for nearest
+     *  neighbour queries.  The tree is built once in the constructor,
+     *  and the coordinates are stored in one contiguous array in tree
+     *  order.  The query functions do not modify the tree, and may be
+     *  called concurrently from several threads.
+     */
+
+class GO_API PointKdTree {
+public:
+    /// Build the tree from a set of points, which must all have the
+    /// same dimension.
+    PointKdTree(const std::vector<Point>& pts);
+
+    /// Build the tree from 'nmb_pts' points of dimension 'dim' stored
+    /// consecutively in 'coords'.
+    PointKdTree(const double* coords, int nmb_pts, int dim);
+
+    /// Do not inherit from this class -- nonvirtual destructor.
+    ~PointKdTree() { }
+
+    /// Number of points in the tree
+    int size() const { return (int)index_.size(); }
+
+    /// Dimension of the points in the tree
+    int dimension() const { return dim_; }
+
+    /// Find the point in the tree closest to 'pt' (of the same dimension
+    /// as the tree).  Only points with squared distance less than
+    /// 'max_dist2' are considered, a non-positive value means no limit.
+    /// \param pt the query point
+    /// \param dist2 the squared distance to the closest point, if found
+    /// \param max_dist2 upper limit of the squared distance
+    /// \return the index (in the input sequence) of the closest point,
+    ///         or -1 if no point was found within the limit.
+    int closestPoint(const double* pt, double& dist2,
+		     double max_dist2 = -1.0) const;
+
+    /// Convenience function, see above.
+    int closestPoint(const Point& pt, double& dist2,
+		     double max_dist2 = -1.0) const
+    { return closestPoint(pt.begin(), dist2, max_dist2); }
+
+    /// Return the coordinates of point number 'idx' in the input sequence
+    Point point(int idx) const;
+
+private:
+    int dim_;
+    std::vector<double> coords_;  // Coordinates, in tree order
+    std::vector<int> index_;      // Input index of the points, in tree order
+    std::vector<int> pos_;        // Tree position of the points, in input order
+    std::vector<char> split_;     // Splitting direction of the node at each position
+
+    void build(const double* coords, int nmb_pts);
+    void closest(int lo, int hi, const double* pt,
+		 int& best_pos, double& best_dist2) const;
+};
+
+} // namespace Go
+
+#endif // _POINTKDTREE_H
@@ -43,10 +43,16 @@
 
 #include <vector>
 #include "GoTools/utils/Point.h"
+#include "GoTools/utils/config.h"
 
 
 namespace Go
 {
+  namespace boxStructuring
+  {
+    class BoundingBoxStructure;
+  }
+
   /// Enumerator for registration error reasons
   /// RegistrationOK   No error found
   /// TooFewPoints     Less than three points are given
@@ -70,7 +76,10 @@ namespace Go
         tolerance_weight_rescale_(1.0),
         max_solve_iterations_(150),
         solve_tolerance_(1.0e-8),
-        multi_core_(true)
+        multi_core_(true),
+        max_icp_iterations_(50),
+        icp_tolerance_(1.0e-4),
+        max_pair_distance_(-1.0)
     {
     }
 
@@ -109,6 +118,19 @@ namespace Go
     /// If true, and if OPENMP is included, run the fine registration in multicore
     bool multi_core_;
 
+    /// Maximum number of iterations in the iterative closest point registration
+    int max_icp_iterations_;
+
+    /// The iterative closest point registration stops when the relative change in the
+    /// mean square distance between matched points is smaller than this value, or when the
+    /// size of the update of the transformation (rotation angle, rescaling and translation relative
+    /// to the extent of the point cloud) is smaller than this value
+    double icp_tolerance_;
+
+    /// Point pairs further apart than this distance are not used in the iterative closest
+    /// point registration. A non-positive value means that all pairs are used
+    double max_pair_distance_;
+
     /// Set the tolerance weights used in Newtons method
     void setToleranceWeights(double w_rotation, double w_translation, double w_rescaling)
     {
@@ -150,6 +172,20 @@ namespace Go
     /// Only used for fine registration
     int solve_result_;
 
+    /// The iteration number (starting at 0) of the last iteration in the iterative closest
+    /// point registration, or the maximum number of iterations if it did not converge.
+    /// Only used for iterative closest point registration
+    int last_icp_iteration_;
+
+    /// The mean square distance between the matched points at the start of each iteration
+    /// in the iterative closest point registration.
+    /// Only used for iterative closest point registration
+    std::vector<double> icp_mean_square_dist_;
+
+    /// The number of point pairs used in the last iteration of the iterative closest point registration.
+    /// Only used for iterative closest point registration
+    int nmb_icp_pairs_;
+
     /// Return wether the result of the registration was RegistrationOK
     bool ok()
     {
@@ -187,6 +223,31 @@ namespace Go
   RegistrationResult registration(const std::vector<Point>& points_fixed, const std::vector<Point>& points_transform,
 				  bool allow_rescaling, RegistrationInput params);
 
+  /// Iterative closest point registration of two point clouds in 3D. Get the rotation, rescaling (optional) and
+  /// translation that sends the second point cloud as close as possible to the first. The point clouds need not
+  /// have the same size, and no ordering is assumed. In each iteration every transformed point is matched with the
+  /// closest point in the fixed cloud, found by a k-d tree, and the transformation is updated by one Gauss-Newton step
+  /// for the sum of square distances. The clouds should be roughly aligned in advance, e.g. by 'initial'.
+  /// points_fixed     - The fixed point cloud
+  /// points_transform - The point cloud to be transformed
+  /// allow_rescaling  - Whether the transformation may include a rescaling
+  /// params           - Iteration parameters, see max_icp_iterations_, icp_tolerance_, max_pair_distance_ and multi_core_
+  /// initial          - If given, the start transformation. Otherwise the identity is used
+  /// returns the transformation sending points_transform to points_fixed, together with convergence information
+  RegistrationResult icpRegistration(const std::vector<Point>& points_fixed, const std::vector<Point>& points_transform,
+				     bool allow_rescaling, RegistrationInput params,
+				     const RegistrationResult* initial = NULL);
+
+  /// Iterative closest point registration of a point cloud in 3D against a surface model. As above, but the
+  /// points are matched with their closest points on the surfaces in the preprocessed structure, see
+  /// preProcessClosestVectors() in ClosestPointUtils.h, and the Gauss-Newton step is made for the sum of
+  /// square distances to the surfaces. This is the distance to the tangent plane at the closest points,
+  /// and converges much faster than matching points only.
+  RegistrationResult icpRegistration(const shared_ptr<boxStructuring::BoundingBoxStructure>& structure,
+				     const std::vector<Point>& points_transform,
+				     bool allow_rescaling, RegistrationInput params,
+				     const RegistrationResult* initial = NULL);
+
 
 } // namespace Go
 
@@ -110,6 +110,29 @@ void make_matrix(const SplineSurface& surf, int deg,
 void make_matrix(const PointCloud4D& cloud, int deg,
 		 std::vector<std::vector<double> >& mat);
 
+/// Evaluate all the tetrahedral Bernstein polynomials of degree deg
+/// in a point given in barycentric coordinates. tmp is used as
+/// scratch. Both vectors must have room for all the polynomials.
+void tetrahedral_basis(const Array<double, 4>& pt, int deg,
+		       std::vector<double>& basis, std::vector<double>& tmp);
+
+/// Make the Gram matrix D^T D of the matrix D for a point cloud
+/// without storing D. The points are converted to barycentric
+/// coordinates on the fly. The result is stored row by row.
+void make_gram_matrix(const PointCloud3D& cloud, const BaryCoordSystem3D& bc,
+		      int deg, std::vector<double>& gram);
+
+/// Performs implicitization from the Gram matrix D^T D, stored row by
+/// row, by solving a symmetric eigenvalue problem. The null-vector is
+/// selected with the same rule as in make_implicit_svd() applied to
+/// D, using the square roots of the eigenvalues as singular values.
+/// The accuracy in sigma_min is limited to about the square root of
+/// the machine precision relative to the largest singular value, thus
+/// if the null space of D has more than one dimension, another vector
+/// in the null space may be returned.
+void make_implicit_gram(const std::vector<double>& gram,
+			std::vector<double>& b, double& sigma_min);
+
 /// Performs implicitization using SVD. This method is suitable when
 /// the implicitization is approximate. If the implicitization is
 /// exact, make_implicit_gauss() is better. Based on the function
@@ -71,16 +71,16 @@ namespace Go {
 class ImplicitizePointCloudAlgo {
 public:
     /// Default constructor
-    ImplicitizePointCloudAlgo() : tol_(3.0e-15) { }
+    ImplicitizePointCloudAlgo() : tol_(3.0e-15), use_gram_(false) { }
     /// Constructor.
     /// \param deg degree of the implicit representation
     explicit ImplicitizePointCloudAlgo(int deg)
-	: deg_(deg), tol_(3.0e-15) { }
+	: deg_(deg), tol_(3.0e-15), use_gram_(false) { }
     /// Constructor.
     /// \param cloud point cloud to be implicitized
     /// \param deg degree of the implicit representation
     ImplicitizePointCloudAlgo(const PointCloud3D& cloud, int deg)
-	: cloud_(cloud), deg_(deg), tol_(3.0e-15) { }
+	: cloud_(cloud), deg_(deg), tol_(3.0e-15), use_gram_(false) { }
 
     /// Load the point cloud to be implicitized.
     /// \param cloud point cloud on PointCloud3D form
@@ -97,6 +97,17 @@ public:
     void setTolerance(double tol)
     { tol_ = tol; }
 
+    /// Choose how the null-vector is computed. By default, the full
+    /// matrix D with one row per point is made and an SVD is
+    /// performed. With the Gram matrix option, D^T D is accumulated
+    /// directly from the points, in parallel if OpenMP is enabled, and
+    /// a symmetric eigenvalue problem of size equal to the number of
+    /// Bernstein polynomials is solved. The memory consumption is then
+    /// independent of the number of points.
+    /// \param use_gram true if the Gram matrix should be used
+    void useGramMatrix(bool use_gram)
+    { use_gram_ = use_gram; }
+
     /// Perform the implicitization.
     /// This function runs the implicitization algorithm.
     void perform();
@@ -121,6 +132,7 @@ private:
     int deg_;
     double tol_;
     double sigma_min_;
+    bool use_gram_;
 
 };
 
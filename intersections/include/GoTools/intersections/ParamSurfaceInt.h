@@ -704,6 +704,11 @@ protected:
  private:
     void makeMesh(int size1, int size2) const;
 
+    void splitSplineSurface(shared_ptr<ParamSurface> srf, int pardir,
+			    double par,
+			    std::vector<shared_ptr<ParamSurface> >& sub1,
+			    std::vector<shared_ptr<ParamSurface> >& sub2);
+
     void computeDegDomain(double aepsge);
 
 };
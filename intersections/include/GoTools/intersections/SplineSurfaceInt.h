@@ -79,6 +79,21 @@ public:
     virtual shared_ptr<ParamSurfaceInt> 
     makeIntObject(shared_ptr<ParamSurface> surf);
 
+    /// Subdivide the object in the specified parameter direction and
+    /// parameter value. If the normal surface exists, it is split
+    /// once and shared with the sub objects.
+    /// \param pardir direction in which to subdive. Indexing starts
+    /// at 0.
+    /// \param par parameter in which to subdivide.
+    /// \param subdiv_objs The subparts of this object. Of the same
+    /// geometric dimension as this object.
+    /// \param bd_objs the boundaries between the returned \a
+    /// subdiv_objs. Of geometric dimension 1 less than this object.
+    virtual void
+    subdivide(int pardir, double par, 
+	      std::vector<shared_ptr<ParamGeomInt> >& subdiv_objs,
+	      std::vector<shared_ptr<ParamGeomInt> >& bd_objs);
+
     /// Return an intersection object for the input curve, using
     /// parameter parent as parent.
     /// \param crv the parametric curve defining the intersection
@@ -277,6 +292,8 @@ protected:
 							 // surface
 
 private:
+    // Pieces of normalsf_ during subdivision
+    std::vector<shared_ptr<SplineSurface> > normalsf_pieces_;
 
 };
 
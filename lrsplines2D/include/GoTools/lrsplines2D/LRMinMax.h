@@ -46,6 +46,7 @@
 namespace Go {
 
   class CurveOnSurface;
+  class CurveBoundedDomain;
 
 /// Computation of extremal points on LR B-spline surface
 namespace LRMinMax {
@@ -56,10 +57,38 @@ void computeMinMaxPoints(shared_ptr<ParamSurface> surface,
 			 std::vector<std::pair<Point, Point> >& minpoints,
 			 std::vector<std::pair<Point, Point> >& maxpoints);
 
+  /// Global extremal points of a height surface given as an LR B-spline
+  /// surface, possibly trimmed. 
+  /// \param sgn 1 for maximum points, -1 for minimum points
+  /// \retval extpoints all points with a value within tol of the extremum,
+  /// given as pairs of positions and parameter pairs
+  /// \return number of tensor-product patches the surface is split into
  int computeExtremalPoints(shared_ptr<ParamSurface> surface,
 			    int sgn, double tol, double epsge,
 			    std::vector<std::pair<Point, Point> >& extpoints);
 
+  /// The nmb_ext most extreme points of a height surface. The surface is
+  /// split into tensor-product patches and patches that cannot improve the
+  /// current candidates, according to the range of their coefficients, are
+  /// not searched. All points found in a searched patch are candidates,
+  /// and candidates closer than tol in the parameter domain count as one
+  /// point. Local extrema that are not the most extreme in their patch
+  /// may be missed. 
+  /// If nmb_ext <= 1, the function behaves as the previous one.
+  /// \retval extpoints at most nmb_ext points sorted from the most extreme
+  /// \return number of tensor-product patches the surface is split into
+  int computeExtremalPoints(shared_ptr<ParamSurface> surface,
+			    int sgn, int nmb_ext, double tol, double epsge,
+			    std::vector<std::pair<Point, Point> >& extpoints);
+
+  /// As above, but the search is restricted to a domain in the parameter
+  /// plane of the surface. If the surface is trimmed, the domain replaces
+  /// the trimming of the underlying LR B-spline surface.
+  int computeExtremalPoints(shared_ptr<ParamSurface> surface,
+			    const CurveBoundedDomain& domain,
+			    int sgn, int nmb_ext, double tol, double epsge,
+			    std::vector<std::pair<Point, Point> >& extpoints);
+
 } // End of namespace LRMinMax
 
 } // End of namespace Go
@@ -663,6 +663,28 @@ namespace Go
     curr_element_ = curr_el;
   }
 
+  // Compute and store the Bezier coefficients of all elements. When the
+  // cache exists, point evaluation (including derivatives and thereby
+  // closest point computations) is performed on the Bezier form of the
+  // element. The cache is removed by all member functions modifying
+  // the surface. If coefficients are modified directly through the
+  // LR B-splines, clearBezierCache() must be called. 
+  // Not thread safe, must not be called while the surface is evaluated 
+  // from other threads.
+  void computeBezierCache() const;
+
+  // Remove the Bezier coefficients of the elements
+  void clearBezierCache() const
+  {
+    bezier_cache_.clear();
+  }
+
+  // Check if element Bezier coefficients are available
+  bool hasBezierCache() const
+  {
+    return !bezier_cache_.empty();
+  }
+
   // ----------------------------------------------------
   // --------------- DEBUG FUNCTIONS --------------------
   // ----------------------------------------------------
@@ -715,6 +737,9 @@ namespace Go
   mutable RectDomain domain_;
   mutable Element2D* curr_element_;
 
+  // Bezier coefficients of each element, computed on request
+  mutable std::unordered_map<const Element2D*, std::vector<double> > bezier_cache_;
+
 
 #if 0
   // @@sbr Remove this when LRSplineEvalGrid does not need them any longer!
@@ -731,6 +756,19 @@ namespace Go
     collect_basis(int from_u, int to_u, 
 		  int from_v, int to_v) const;
 
+    // Evaluate position and derivatives in the given element from its 
+    // Bezier coefficients. Returns false if the coefficients are not 
+    // available
+    bool bezierPoint(const Element2D* elem, double upar, double vpar,
+		     int derivs, Point* pts) const;
+
+    // Bezier coefficients of an element, taken from the cache if 
+    // available and otherwise computed and stored in the local cache
+    const std::vector<double>& 
+      elementBezierCoefs(const Element2D* elem,
+			 std::unordered_map<const Element2D*, 
+			 std::vector<double> >& local) const;
+
     void 
       s1773(const double ppoint[],double aepsge, 
 	    double estart[],double eend[],double enext[],
@@ -184,6 +184,30 @@ namespace Go
 			   bool u_at_end, bool v_at_end, 
 			   std::vector<Point>& result);
 
+    /// Compute the coefficients of the surface restricted to the given
+    /// element expressed in the tensor product Bernstein basis of the
+    /// element. The coefficients are stored with the u-index running
+    /// fastest, each coefficient occupying dimension() entries. For
+    /// rational surfaces the coefficients are given in homogeneous form,
+    /// i.e. multiplied by the weight and followed by the weight itself.
+    /// \param surf the surface
+    /// \param elem element of the surface
+    /// \param coefs the Bezier coefficients, size
+    /// (deg_u+1)*(deg_v+1)*(dim + rational)
+    void elementBezierCoefs(const LRSplineSurface& surf, const Element2D* elem,
+			    std::vector<double>& coefs);
+
+    /// Evaluate position and derivatives of a tensor product Bezier patch
+    /// defined over the domain [umin,umax]x[vmin,vmax], with coefficients
+    /// stored as given by elementBezierCoefs().
+    /// \param result (derivs+1)*(derivs+2)/2 entries of dimension kdim
+    /// ordered as P, Du, Dv, Duu, Duv, Dvv, ... For rational surfaces, the
+    /// result is homogeneous.
+    void evalBezierElement(const double* coefs, int deg_u, int deg_v,
+			   int kdim, double umin, double umax,
+			   double vmin, double vmax, double upar, double vpar,
+			   int derivs, double* result);
+
     //==============================================================================
     struct support_compare
     //==============================================================================
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+
+#ifndef _LRSURFDISTANCE_H
+#define _LRSURFDISTANCE_H
+
+#include "GoTools/lrsplines2D/LRSplineSurface.h"
+#include <vector>
+
+namespace Go
+{
+
+/// Computation of vertical distances between a point cloud and a
+/// one-dimensional LR B-spline surface (height function). The element
+/// structure of the surface and the Bezier coefficients of each element
+/// are computed once at construction, after which any number of point
+/// batches may be processed without sorting the points or rebuilding
+/// the element grid. Points are given as (u, v, z) triples, and the
+/// signed distance is z - f(u,v). Points are processed in parallel if
+/// OpenMP is enabled. The engine is a snapshot of the surface; it must
+/// be reconstructed if the surface is modified.
+/// Contrary to the functions in LRApproxApp, distances are not computed
+/// by closest point projection.
+class GO_API LRSurfDistance
+{
+public:
+  /// Constructor. The surface must be one-dimensional.
+  LRSurfDistance(const LRSplineSurface& surf);
+
+  /// Number of distinct elements
+  int numElements() const
+  {
+    return (int)elem_dom_.size()/4;
+  }
+
+  /// Index of the element containing the parameter pair (u,v). Points on
+  /// a common boundary are associated with the element with the largest
+  /// parameter values, except at the end of the domain. Returns -1 if the
+  /// parameter pair is outside the surface domain.
+  int locateElement(double u, double v) const;
+
+  /// Evaluate the surface at (u,v) which is required to lie in the given
+  /// element.
+  double evalElement(int elem, double u, double v) const;
+
+  /// Compute signed distances for a batch of points.
+  /// \param points (u, v, z) triples, size 3*nmb_pts
+  /// \param nmb_pts number of points
+  /// \param dist signed distance for each point, 0.0 for points outside
+  /// the surface domain
+  /// \param elem_ix if non-zero, the element index for each point or -1
+  /// for points outside the surface domain
+  /// \return number of points inside the surface domain
+  int computeDistances(const double* points, int nmb_pts, double* dist,
+		       int* elem_ix = 0) const;
+
+  /// Compute signed distances for a batch of points, classify each point
+  /// according to the distance and compute statistics. The point order is
+  /// retained. The statistics concern this batch only. When streaming
+  /// points in batches, the results may be combined by the caller.
+  /// \param points (u, v, z) triples, size 3*nmb_pts
+  /// \param nmb_pts number of points
+  /// \param limits increasing distance limits defining the classes
+  /// \param classification for each point, the index of the first limit
+  /// exceeding the distance, limits.size() if no such limit exist and -1
+  /// if the point is outside the surface domain
+  /// \param nmb_group number of points in each class, size limits.size()+1
+  /// \param max_above largest positive distance
+  /// \param max_below largest negative distance
+  /// \param avdist average absolute distance
+  /// \param nmb_points number of points inside the surface domain
+  /// \param dist if non-zero, the signed distance for each point
+  void categorize(const double* points, int nmb_pts,
+		  const std::vector<double>& limits,
+		  int* classification, std::vector<int>& nmb_group,
+		  double& max_above, double& max_below, double& avdist,
+		  int& nmb_points, double* dist = 0) const;
+
+private:
+  int deg_u_;
+  int deg_v_;
+  bool rational_;
+  int kdim_;    // 1, or 2 for rational surfaces
+  int ncoef_;   // Number of Bezier coefficients per element (including kdim_)
+
+  std::vector<double> uknots_;   // Distinct knots in the u-direction
+  std::vector<double> vknots_;   // Distinct knots in the v-direction
+  std::vector<int> cell_elem_;   // Element index for each knot cell
+  std::vector<double> elem_dom_; // umin, umax, vmin, vmax per element
+  std::vector<double> bezier_;   // Bezier coefficients, ncoef_ per element
+
+  int knotCell(const std::vector<double>& knots, double par) const;
+};
+
+} // namespace Go
+
+#endif // _LRSURFDISTANCE_H
@@ -44,6 +44,7 @@
 #include "GoTools/lrsplines3D/LRSplineVolume.h"
 #include "GoTools/lrsplines3D/Element3D.h"
 #include "GoTools/lrsplines3D/Mesh3D.h"
+#include "GoTools/lrsplines3D/LRSpline3DFlat.h"
 
 #include <vector>
 
@@ -90,121 +91,13 @@ public:
       return elements_.end();
     }
 
+    // Evaluate the element in a grid of order_U*order_V*order_W
+    // equidistant parameter values including the element boundaries
     template <class V>
-      void evaluateGrid(V &element, double *points)
+      void evaluateGrid(V &element, double *points) const
       {
-	int order_U = orderU();
-	int order_V = orderV();
-	int order_W = orderW();
-	double ll_x=element.umin(), ll_y=element.vmin(), ll_z=element.wmin();
-	double ur_x=element.umax(), ur_y=element.vmax(), ur_z=element.wmax();
-	/* low(element, ll_x, ll_y, ll_z); */
-	/* high(element, ur_x, ur_y, ur_z); */
-	
-	auto du = (ur_x - ll_x) / (order_U - 1);
-	auto dv = (ur_y - ll_y) / (order_V - 1);
-	auto dw = (ur_z - ll_z) / (order_W - 1);
-
-	std::fill(points, points+order_U*order_V*order_W*dim_, 0.0);
-	const std::vector<LRBSpline3D*> bfunctions = element.getSupport();
-	size_t bsize = bfunctions.size();
-
-	// Evaluate univariate B-splines
-	std::vector<double> val1(bsize*order_U);
-	std::vector<double> val2(bsize*order_V);
-	std::vector<double> val3(bsize*order_W);
-	for (size_t ki=0; ki<bsize; ++ki)
-	  {
-	    size_t kj;
-	    const BSplineUniLR* uni1 =  bfunctions[ki]->getUnivariate(XDIR);
-	    const BSplineUniLR* uni2 =  bfunctions[ki]->getUnivariate(YDIR);
-	    const BSplineUniLR* uni3 =  bfunctions[ki]->getUnivariate(ZDIR);
-	    for (kj=0; kj<ki; ++kj)
-	      if (uni1 == bfunctions[kj]->getUnivariate(XDIR))
-		break;
-	    if (kj < ki)
-	      std::copy(val1.begin()+kj*order_U, val1.begin()+(kj+1)*order_U,
-			val1.begin()+ki*order_U);
-	    else
-	      {
-		double par = ll_x;
-		for (int ka=0; ka<order_U; ++ka, par+=du)
-		  {
-		    const bool on_end = (par == bfunctions[ki]->umax());
-		    val1[ki*order_U+ka] = uni1->evalBasisFunction(par, 0, on_end);
-		  }
-	      }
-		
-	    for (kj=0; kj<ki; ++kj)
-	      if (uni2 == bfunctions[kj]->getUnivariate(ZDIR))
-		break;
-	    if (kj < ki)
-	      std::copy(val2.begin()+kj*order_V, val2.begin()+(kj+1)*order_V,
-			val2.begin()+ki*order_V);
-	    else
-	      {
-		double par = ll_y;
-		for (int ka=0; ka<order_V; ++ka, par+=dv)
-		  {
-		    const bool on_end = (par == bfunctions[ki]->vmax());
-		    val2[ki*order_V+ka] = uni2->evalBasisFunction(par, 0, on_end);
-		  }
-	      }
-		
-	    for (kj=0; kj<ki; ++kj)
-	      if (uni3 == bfunctions[kj]->getUnivariate(ZDIR))
-		break;
-	    if (kj < ki)
-	      std::copy(val3.begin()+kj*order_W, val3.begin()+(kj+1)*order_W,
-			val3.begin()+ki*order_W);
-	    else
-	      {
-		double par = ll_z;
-		for (int ka=0; ka<order_W; ++ka, par+=dw)
-		  {
-		    const bool on_end = (par == bfunctions[ki]->wmax());
-		    val3[ki*order_W+ka] = uni3->evalBasisFunction(par, 0, on_end);
-		  }
-	      }
-	  }
-
-	Point pt;
-	double *p=points;
-	int ix2=0;
-	for (int i=0; i<order_W; ++i)
-	  for (int j=0; j<order_V; ++j)
-	    for (int k=0; k<order_U; ++k, p+=dim_)
-	      for (size_t ix=0; ix<bsize; ++ix)
-		{
-		  pt = bfunctions[ix]->coefTimesGamma();
-		  for (int ka=0; ka<dim_; ++ka)
-		    p[ka] +=
-		      pt[ka]*val1[ix*order_U+k]*
-		      val2[ix*order_V+j]*
-		      val3[ix*order_W+i];
-		  //(*p) += pt[ka]*val1[k*bsize+ix]*val2[j*bsize+ix]*val3[i*bsize+ix];
-		}
-		  
-	    /* auto w=ll_z; */
-	    /* for (int i=0; i<order_W; i++, w += dw) { */
-            /*   if (i==order_W-1) { */
-            /*     w=ur_z; */
-            /*   } */
-            /*   auto v=ll_y; */
-            /*   for (int j=0; j<order_V; j++, v += dv) { */
-	    /* 	if (j==order_V-1) { */
-            /*       v=ur_y; */
-	    /* 	} */
-	    /* 	auto u=ll_x; */
-	    /* 	for (int k=0; k<order_U; k++, u += du) { */
-            /*       if (k==order_U-1) { */
-            /*         u=ur_x; */
-            /*       } */
-            /*       evaluate(element, u, v, w, p); */
-            /*       p+=dim_; */
-	    /* 	} */
-            /*   } */
-            /* } */
+	int el = elementIndex(element);
+	flat_.elementGrid(el, orderU(), orderV(), orderW(), points);
       }
 
   // It appears that this function expects u,v,w \in [0,1]
@@ -217,34 +110,8 @@ public:
       double scaledW = w *(orig_dom_[5]-orig_dom_[4]);
       scaledW += orig_dom_[4];
       
-      //assert(dim_ == 1 || dim_ == 3);
-
-      Point result(dim_);
-      result.setValue(0.0);
-
-      const std::vector<LRBSpline3D*> covering_B_functions = elem.getSupport();
-
-      for (auto b = covering_B_functions.begin();
-	   b != covering_B_functions.end(); ++b)
-	{
-	  const bool u_on_end = (scaledU == (*b)->umax());
-	  const bool v_on_end = (scaledV == (*b)->vmax());
-	  const bool w_on_end = (scaledW == (*b)->wmax());
-
-	  result += (*b)->eval(scaledU, 
-			       scaledV, 
-                               scaledW, 
-			       0, // No derivs.
-			       0, // No derivs.
-                               0, // No derivs.
-			       u_on_end, 
-                               v_on_end, 
-			       w_on_end);
-	}
-
-      for (int ix=0; ix!=dim_; ++ix) {
-        res[ix] = result[ix];
-      }
+      int hint = elementIndex(elem);
+      flat_.point(scaledU, scaledV, scaledW, res, hint);
     }
 
   int numElements() const
@@ -306,9 +173,19 @@ public:
 
 
 private:
+    // Index of the element in the flat representation
+    template <class V>
+      int elementIndex(const V &element) const
+      {
+	return flat_.locate(0.5*(element.umin()+element.umax()),
+			    0.5*(element.vmin()+element.vmax()),
+			    0.5*(element.wmin()+element.wmax()));
+      }
+
     // umin, umax, vmin, vmax, wmin, wmax
     Array<double,6> orig_dom_;
     std::vector<Element3D> elements_;
+    LRSpline3DFlat flat_;   // Evaluation
     int order_u_;
     int order_v_;
     int order_w_;
@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRSPLINE3DFLAT_H
+#define _LRSPLINE3DFLAT_H
+
+#include "GoTools/lrsplines3D/Mesh3D.h"
+#include "GoTools/lrsplines3D/Direction3D.h"
+
+#include <vector>
+
+
+namespace Go
+{
+
+class LRSplineVolume;
+class Element3D;
+class LRBSpline3D;
+
+// =============================================================================
+/// Frozen, contiguous copy of a non-rational LRSplineVolume intended for
+/// repeated evaluation. Element bounds, element supports, the knot vectors
+/// of the univariate B-splines and the coefficients (multiplied by the
+/// scaling factor) are stored in flat arrays, the elements in the same
+/// sequence as in the element map of the volume and the basis functions
+/// in the same sequence as in the B-spline map.
+/// The evaluation functions are const and do not change any state
+/// (unlike LRSplineVolume::point() which updates the current element),
+/// thus they may be called concurrently. The element found by the last
+/// evaluation is returned in a hint owned by the caller.
+/// The object is a snapshot. It is not updated when the volume is
+/// refined or its coefficients are changed and must then be rebuilt.
+/// The volume must outlive the object if element() or basisFunction()
+/// is used.
+class LRSpline3DFlat
+// =============================================================================
+{
+public:
+  /// Empty object
+  LRSpline3DFlat();
+
+  /// Make a flat copy of the given volume. The volume must be non-rational.
+  LRSpline3DFlat(const LRSplineVolume& vol);
+
+  /// Dimension of geometry space
+  int dimension() const
+  {
+    return dim_;
+  }
+
+  /// Polynomial degree in the given parameter direction
+  int degree(Direction3D d) const
+  {
+    return deg_[d];
+  }
+
+  /// Number of elements
+  int numElements() const
+  {
+    return (int)elem_volume_.size();
+  }
+
+  /// Number of basis functions
+  int numBasisFunctions() const
+  {
+    return (int)bspline_.size();
+  }
+
+  /// Parameter domain given as umin, umax, vmin, vmax, wmin, wmax
+  const double* domain() const
+  {
+    return dom_;
+  }
+
+  /// Element bounds given as umin, umax, vmin, vmax, wmin, wmax
+  const double* elementBounds(int el) const
+  {
+    return &elem_bd_[6*el];
+  }
+
+  /// Number of basis functions with support in element el
+  int nmbSupport(int el) const
+  {
+    return supp_start_[el+1] - supp_start_[el];
+  }
+
+  /// Indices of the basis functions with support in element el. The
+  /// sequence corresponds to Element3D::getSupport().
+  const int* support(int el) const
+  {
+    return &supp_[supp_start_[el]];
+  }
+
+  /// Coefficient of basis function bs multiplied by its scaling factor
+  const double* coefTimesGamma(int bs) const
+  {
+    return &coef_[bs*dim_];
+  }
+
+  /// Scaling factor of basis function bs
+  double gamma(int bs) const
+  {
+    return gamma_[bs];
+  }
+
+  /// The element in the volume corresponding to index el
+  Element3D* element(int el) const
+  {
+    return elem_volume_[el];
+  }
+
+  /// The basis function in the volume corresponding to index bs
+  LRBSpline3D* basisFunction(int bs) const
+  {
+    return bspline_[bs];
+  }
+
+  /// Index of the element containing the parameter triple. The element
+  /// given by hint is tested first, other elements are found by a lookup
+  /// in the mesh. Returns -1 if the parameter is outside the domain.
+  int locate(double upar, double vpar, double wpar, int hint = -1) const;
+
+  /// Evaluate all basis functions with support in element el. The values
+  /// are not scaled by gamma and are given in the sequence of support(el).
+  /// The polynomial pieces of el are used also on the element boundary.
+  /// \param val array of size at least nmbSupport(el)
+  void basisValues(int el, double upar, double vpar, double wpar,
+		   double* val) const;
+
+  /// Evaluate the volume in the given parameter triple. hint is an element
+  /// index owned by the caller and is updated to the element containing
+  /// the parameter. Use -1 if no element is known.
+  /// \param res array of size dimension()
+  void point(double upar, double vpar, double wpar, double* res,
+	     int& hint) const;
+
+  /// Evaluate the volume and its derivatives up to order derivs. The
+  /// sequence of the output is as for LRSplineVolume::point, i.e. 
+  /// S, Su, Sv, Sw, Suu, Suv, Suw, Svv, Svw, Sww, ...
+  /// \param res array of size dimension()*(derivs+1)*(derivs+2)*(derivs+3)/6
+  void point(double upar, double vpar, double wpar, int derivs, double* res,
+	     int& hint) const;
+
+  /// Evaluate the volume in an equidistant grid of nmb_u*nmb_v*nmb_w
+  /// parameter values covering element el including its boundaries. The
+  /// points are stored sequentially with u running fastest.
+  /// \param res array of size nmb_u*nmb_v*nmb_w*dimension()
+  void elementGrid(int el, int nmb_u, int nmb_v, int nmb_w,
+		   double* res) const;
+
+  /// Evaluate the volume in a rectilinear grid given by increasing parameter
+  /// values in each direction. The grid is evaluated element by element
+  /// using tabulated univariate B-spline values, and the elements are
+  /// distributed between threads if OpenMP is enabled. Grid points outside
+  /// the domain are set to zero. Large grids can be evaluated in slabs by
+  /// splitting param_w.
+  /// \param res array of size 
+  ///        param_u.size()*param_v.size()*param_w.size()*dimension(), 
+  ///        the points are stored with u running fastest
+  void gridEvaluate(const std::vector<double>& param_u,
+		    const std::vector<double>& param_v,
+		    const std::vector<double>& param_w,
+		    double* res) const;
+
+  /// Compute the parameter values of a set of points in the volume.
+  /// Candidate elements are found from the bounding boxes of the
+  /// coefficients of each element, and a Newton iteration is started in
+  /// each candidate element until the point is found within the
+  /// tolerance. The points are distributed between threads if OpenMP is
+  /// enabled. The volume must be 3-dimensional.
+  /// \param pts the points, stored as x0, y0, z0, x1, y1, z1, ...
+  /// \param params upon return, three parameter values for each point
+  /// \param dist upon return, the distance between each point and the
+  ///             volume evaluated in the corresponding parameter values
+  /// \param converged upon return, 1 if the point is found within
+  ///                  the tolerance, 0 otherwise
+  /// \param epsilon geometric tolerance
+  /// \return the number of points found within the tolerance
+  int inverseMapping(const std::vector<double>& pts,
+		     std::vector<double>& params,
+		     std::vector<double>& dist,
+		     std::vector<int>& converged,
+		     double epsilon) const;
+
+private:
+  int dim_;
+  int deg_[3];
+  double dom_[6];
+  Mesh3D mesh_;   // Used in element lookup
+
+  // Knots of the distinct univariate B-splines, deg+2 entries for each
+  std::vector<double> knots_[3];
+
+  // Basis function information
+  std::vector<int> uni_;      // Univariate index for each direction
+  std::vector<double> coef_;  // Coefficients times gamma
+  std::vector<double> gamma_;
+  std::vector<LRBSpline3D*> bspline_;
+
+  // Element information
+  std::vector<double> elem_bd_;
+  std::vector<int> supp_start_;
+  std::vector<int> supp_;
+  // Distinct univariate B-splines in each element and parameter direction,
+  // and the position of each support entry in these lists
+  std::vector<int> elem_uni_start_[3];
+  std::vector<int> elem_uni_[3];
+  std::vector<int> supp_uni_;
+  std::vector<Element3D*> elem_volume_;
+
+  // Evaluate the distinct univariate B-splines of element el in one
+  // parameter direction. The value and der derivatives are stored
+  // consecutively for each B-spline.
+  void univariateValues(int el, int pardir, double par, int der,
+			double* val) const;
+
+  // Evaluate the volume in a grid of parameters inside element el. Point
+  // (ki,kj,kk) is stored at res + (kk*stride_w + kj*stride_v + ki)*dim_.
+  // bval is scratch
+  void blockEvaluate(int el, const double* par[], const int nmb[],
+		     int stride_v, int stride_w, double* res,
+		     std::vector<double> bval[]) const;
+};
+
+} // end namespace Go
+
+#endif // _LRSPLINE3DFLAT_H
@@ -357,6 +357,24 @@ class LRSplineVolume : public ParamVolume
 			      double         epsilon,
 			      double   *seed = 0) const;
 
+    /// Compute the parameter values of a set of points in the volume.
+    /// The evaluation is performed on a flat copy of the volume (see
+    /// LRSpline3DFlat::inverseMapping()), thus the volume must be
+    /// non-rational and 3-dimensional.
+    /// \param pts the points, stored as x0, y0, z0, x1, y1, z1, ...
+    /// \param params upon return, three parameter values for each point
+    /// \param dist upon return, the distance between each point and the
+    ///             volume evaluated in the corresponding parameter values
+    /// \param converged upon return, 1 if the point is found within
+    ///                  the tolerance, 0 otherwise
+    /// \param epsilon geometric tolerance
+    /// \return the number of points found within the tolerance
+    int inverseMapping(const std::vector<double>& pts,
+		       std::vector<double>& params,
+		       std::vector<double>& dist,
+		       std::vector<int>& converged,
+		       double epsilon) const;
+
     /// Returns the corner closest to a given point together with
     /// the associated enumeration of the corner coefficient.
     /// In degenerate cases, the enumeration will reflect an arbitrary 
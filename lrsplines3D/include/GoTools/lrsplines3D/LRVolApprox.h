@@ -43,6 +43,7 @@
 #include "GoTools/trivariate/SplineVolume.h"
 #include "GoTools/trivariate/RectTriDomain.h"
 #include "GoTools/lrsplines3D/LRSplineVolume.h"
+#include "GoTools/lrsplines3D/LRSpline3DFlat.h"
 #include <vector>
 
 
@@ -443,8 +444,11 @@ private:
     void computeAccuracy(std::vector<Element3D*>& ghost_elems); // @obar: why ghost???
     // The same as the above, but with OpenMP support (if flag is turned on).
     void computeAccuracy_omp(std::vector<Element3D*>& ghost_elems);
+    // Compute the distances in the data points of element el in
+    // the flat representation of the volume
     void computeAccuracyElement(std::vector<double>& points, 
-                                int nmb, int del, const Element3D* elem);
+                                int nmb, int del, const LRSpline3DFlat& flat,
+				int el);
     //// The same as the above, but with OpenMP support (if flag is turned on).
     void computeAccuracyElement_omp(std::vector<double>& points,
                                    int nmb, int del, const Element3D* elem);
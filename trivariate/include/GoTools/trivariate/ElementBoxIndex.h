@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _ELEMENTBOXINDEX_H
+#define _ELEMENTBOXINDEX_H
+
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <exception>
+#include <math.h>
+
+
+namespace Go
+{
+
+
+/** Spatial index over the elements of a spline volume in 3D, used to
+ * compute parameter values of points in the volume (inverse mapping).
+ * Each element is represented by the bounding box of the coefficients
+ * of the basis functions having support in the element. The element
+ * is contained in this box by the convex hull property. The boxes are
+ * sorted into a regular grid of bins covering the volume, and the
+ * elements with a box containing a point are used to find start values
+ * for a Newton iteration.
+ */
+class GO_API ElementBoxIndex
+{
+public:
+    /// Empty index
+    ElementBoxIndex();
+
+    /// Constructor.
+    /// \param boxes bounding box of the coefficients of each element,
+    ///              stored as xmin, xmax, ymin, ymax, zmin, zmax
+    /// \param elem_par parameter domain of each element, stored as
+    ///                 umin, umax, vmin, vmax, wmin, wmax
+    /// \param tol the boxes are enlarged by this tolerance
+    ElementBoxIndex(const std::vector<double>& boxes,
+		    const std::vector<double>& elem_par,
+		    double tol);
+
+    /// Number of elements
+    int numElements() const
+    { return (int)elem_par_.size()/6; }
+
+    /// Elements with a box containing a given point, sorted by increasing
+    /// distance between the point and the centre of the box.
+    void candidates(const double* pt, std::vector<int>& elem) const;
+
+    /// The element with the box closest to a given point. Used for points
+    /// outside all boxes. Returns -1 if the index is empty.
+    int closestElement(const double* pt) const;
+
+    /// Compute the parameter values of a number of points in a volume. For
+    /// each point, a Newton iteration is started in the centre of the
+    /// candidate elements until the point is found within the tolerance.
+    /// If no element box contains the point, the element with the closest
+    /// box is used and the iteration will typically end at the boundary
+    /// of the volume. The points are distributed between threads if
+    /// OpenMP is enabled.
+    /// \param eval evaluator of the volume. eval(par, res) computes the
+    ///             position and the first derivatives (S, Su, Sv, Sw) in
+    ///             the parameter triple par. Each thread works on a copy
+    ///             of eval.
+    /// \param dom the parameter domain as umin, umax, vmin, vmax, wmin, wmax
+    /// \param pts the points, stored as x0, y0, z0, x1, y1, z1, ...
+    /// \param epsilon geometric tolerance
+    /// \param params upon return, three parameter values for each point
+    /// \param dist upon return, the distance between each point and the
+    ///             volume evaluated in the corresponding parameter values
+    /// \param converged upon return, 1 if the point is found within the
+    ///                  tolerance, 0 otherwise
+    /// \param max_iter maximum number of Newton iterations for each start
+    ///                 value
+    /// \return the number of points found within the tolerance
+    template <class VolEval>
+    int inverseMapping(const VolEval& eval, const double dom[],
+		       const std::vector<double>& pts, double epsilon,
+		       std::vector<double>& params, std::vector<double>& dist,
+		       std::vector<int>& converged, int max_iter = 20) const;
+
+private:
+    std::vector<double> boxes_;
+    std::vector<double> elem_par_;
+    double bd_[6];    // Box containing all element boxes
+    int nmb_[3];      // Number of bins in each direction
+    double del_[3];   // Size of bins
+    std::vector<int> bin_start_;  // First entry of each bin in bin_elem_
+    std::vector<int> bin_elem_;   // Elements with a box overlapping each bin
+
+    // Bin index in one direction, clamped to the grid
+    int binIndex(int dir, double val) const
+    {
+	int ix = (int)((val - bd_[2*dir])/del_[dir]);
+	return std::max(0, std::min(ix, nmb_[dir]-1));
+    }
+
+    // Damped Newton iteration for the parameter of pt, starting in par.
+    // Returns the distance between pt and the volume in the final
+    // parameter.
+    template <class VolEval>
+    static double newton(VolEval& eval, const double* pt, const double dom[],
+			 double epsilon, int max_iter, double par[]);
+};
+
+
+//===========================================================================
+template <class VolEval>
+int ElementBoxIndex::inverseMapping(const VolEval& eval, const double dom[],
+				    const std::vector<double>& pts,
+				    double epsilon,
+				    std::vector<double>& params,
+				    std::vector<double>& dist,
+				    std::vector<int>& converged,
+				    int max_iter) const
+//===========================================================================
+{
+    int nmb = (int)pts.size()/3;
+    params.resize(3*nmb);
+    dist.resize(nmb);
+    converged.resize(nmb);
+    int nmb_conv = 0;
+    std::exception_ptr error;
+    int ki;
+#ifdef _OPENMP
+#pragma omp parallel default(none) private(ki) \
+  shared(eval, dom, pts, epsilon, params, dist, converged, max_iter, nmb, \
+	 error) reduction(+:nmb_conv)
+#endif
+    {
+	VolEval local(eval);
+	std::vector<int> cand;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+	for (ki=0; ki<nmb; ++ki)
+	{
+	    try
+	    {
+		const double* pt = &pts[3*ki];
+		candidates(pt, cand);
+		if (cand.size() == 0)
+		{
+		    int el = closestElement(pt);
+		    if (el >= 0)
+			cand.push_back(el);
+		}
+
+		double best = std::numeric_limits<double>::max();
+		double par[3], best_par[3];
+		best_par[0] = dom[0];
+		best_par[1] = dom[2];
+		best_par[2] = dom[4];
+		for (size_t kj=0; kj<cand.size(); ++kj)
+		{
+		    const double* ep = &elem_par_[6*cand[kj]];
+		    for (int kd=0; kd<3; ++kd)
+			par[kd] = 0.5*(ep[2*kd] + ep[2*kd+1]);
+		    double dd = newton(local, pt, dom, epsilon, max_iter, par);
+		    if (dd < best)
+		    {
+			best = dd;
+			std::copy(par, par+3, best_par);
+		    }
+		    if (best <= epsilon)
+			break;
+		}
+		std::copy(best_par, best_par+3, params.begin()+3*ki);
+		dist[ki] = best;
+		converged[ki] = (best <= epsilon) ? 1 : 0;
+		nmb_conv += converged[ki];
+	    }
+	    catch (...)
+	    {
+#ifdef _OPENMP
+#pragma omp critical(elementboxindex_error)
+#endif
+		if (!error)
+		    error = std::current_exception();
+	    }
+	}
+    }
+    if (error)
+	std::rethrow_exception(error);
+
+    return nmb_conv;
+}
+
+
+//===========================================================================
+template <class VolEval>
+double ElementBoxIndex::newton(VolEval& eval, const double* pt,
+			       const double dom[], double epsilon,
+			       int max_iter, double par[])
+//===========================================================================
+{
+    double res[12], res2[12];
+    double diff[3], delta[3], par2[3];
+    int kd;
+
+    eval(par, res);
+    double dist2 = 0.0;
+    for (kd=0; kd<3; ++kd)
+    {
+	diff[kd] = res[kd] - pt[kd];
+	dist2 += diff[kd]*diff[kd];
+    }
+
+    const double eps2 = epsilon*epsilon;
+    for (int kr=0; kr<max_iter && dist2 > eps2; ++kr)
+    {
+	// Solve J*delta = -diff by Cramer's rule, the columns of the
+	// Jacobian are the partial derivatives
+	const double* su = res + 3;
+	const double* sv = res + 6;
+	const double* sw = res + 9;
+	double c0 = sv[1]*sw[2] - sv[2]*sw[1];
+	double c1 = sv[2]*sw[0] - sv[0]*sw[2];
+	double c2 = sv[0]*sw[1] - sv[1]*sw[0];
+	double det = su[0]*c0 + su[1]*c1 + su[2]*c2;
+	double scale = sqrt((su[0]*su[0] + su[1]*su[1] + su[2]*su[2])*
+			    (sv[0]*sv[0] + sv[1]*sv[1] + sv[2]*sv[2])*
+			    (sw[0]*sw[0] + sw[1]*sw[1] + sw[2]*sw[2]));
+	if (fabs(det) <= 1.0e-12*scale)
+	    break;    // Singular Jacobian, relative to the size of the
+	              // partial derivatives
+	double r[3] = {-diff[0], -diff[1], -diff[2]};
+	delta[0] = (r[0]*c0 + r[1]*c1 + r[2]*c2)/det;
+	delta[1] = (su[0]*(r[1]*sw[2] - r[2]*sw[1]) +
+		    su[1]*(r[2]*sw[0] - r[0]*sw[2]) +
+		    su[2]*(r[0]*sw[1] - r[1]*sw[0]))/det;
+	delta[2] = (su[0]*(sv[1]*r[2] - sv[2]*r[1]) +
+		    su[1]*(sv[2]*r[0] - sv[0]*r[2]) +
+		    su[2]*(sv[0]*r[1] - sv[1]*r[0]))/det;
+
+	// Halve the step until the distance decreases. The parameter is
+	// kept inside the domain
+	bool improved = false;
+	double fac = 1.0;
+	for (int kh=0; kh<8; ++kh, fac*=0.5)
+	{
+	    for (kd=0; kd<3; ++kd)
+		par2[kd] = std::max(dom[2*kd],
+				    std::min(dom[2*kd+1], par[kd]+fac*delta[kd]));
+	    eval(par2, res2);
+	    double dist2_2 = 0.0;
+	    for (kd=0; kd<3; ++kd)
+	    {
+		double tmp = res2[kd] - pt[kd];
+		dist2_2 += tmp*tmp;
+	    }
+	    if (dist2_2 < dist2)
+	    {
+		improved = true;
+		dist2 = dist2_2;
+		std::copy(par2, par2+3, par);
+		std::copy(res2, res2+12, res);
+		for (kd=0; kd<3; ++kd)
+		    diff[kd] = res[kd] - pt[kd];
+		break;
+	    }
+	}
+	if (!improved)
+	    break;
+    }
+
+    return sqrt(dist2);
+}
+
+
+} // namespace Go
+
+#endif // _ELEMENTBOXINDEX_H
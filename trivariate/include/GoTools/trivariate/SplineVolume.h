@@ -432,6 +432,27 @@ public:
 			      double         epsilon,
 			      double   *seed = 0) const;
 
+    /// Compute the parameter values of a number of points inside the
+    /// volume (inverse mapping). The start values for the Newton iteration
+    /// are found from the bounding boxes of the coefficients of each
+    /// element, and the points are distributed between threads if OpenMP
+    /// is enabled. Points that are not found within the tolerance, as
+    /// points outside the volume, get the best parameter found and may be
+    /// handled by closestPoint(). The volume must be 3-dimensional.
+    /// \param pts the points, stored as x0, y0, z0, x1, y1, z1, ...
+    /// \param params upon return, three parameter values for each point
+    /// \param dist upon return, the distance between each point and the
+    ///             volume evaluated in the corresponding parameter values
+    /// \param converged upon return, 1 if the point is found within
+    ///                  the tolerance, 0 otherwise
+    /// \param epsilon geometric tolerance
+    /// \return the number of points found within the tolerance
+    int inverseMapping(const std::vector<double>& pts,
+		       std::vector<double>& params,
+		       std::vector<double>& dist,
+		       std::vector<int>& converged,
+		       double epsilon) const;
+
     /// Returns the corner closest to a given point together with
     /// the associated enumeration of the corner coefficient.
     /// In degenerate cases, the enumeration will reflect an arbitrary 
@@ -813,6 +834,18 @@ public:
 			const std::vector< double > &param_w,
 			std::vector< double > &points) const;
 
+    /// Evaluate points on an entire grid as above, but store the points in
+    /// a caller-provided array. The points are stored with the first
+    /// parameter direction running fastest. The isosurfaces in the third
+    /// parameter direction are evaluated in parallel if OpenMP is enabled.
+    /// Large grids can be evaluated in slabs by splitting param_w.
+    /// \param points array of size 
+    ///        param_u.size()*param_v.size()*param_w.size()*dimension()
+    void gridEvaluator (const std::vector< double > &param_u,
+			const std::vector< double > &param_v,
+			const std::vector< double > &param_w,
+			double* points) const;
+
     /// Evaluate positions and first derivatives of all basis values in a given parameter tripple
     /// For non-rationals this is an interface to BsplineBasis::computeBasisValues 
     /// where the basis values in each parameter direction are multiplied to 
@@ -1082,6 +1115,16 @@ private:
 		    std::vector< double > &points) const;
 
  private:
+    void pointsGrid(int numu, int numv, int numw,
+		    const double* basisvals_u,
+		    const double* basisvals_v,
+		    const double* basisvals_w,
+		    const int* knotinter_u,
+		    const int* knotinter_v,
+		    const int* knotinter_w,
+		    int derivs,
+		    double* points) const;
+
     void accumulateBasis(double* basisvals_u, int uorder,
 			 double* basisvals_v, int vorder,
 			 double* basisvals_w, int worder,
@@ -43,6 +43,7 @@
 #include "GoTools/compositemodel/CompositeModel.h"
 #include "GoTools/trivariatemodel/ftVolume.h"
 #include "GoTools/trivariate/SplineVolume.h"
+#include <unordered_map>
 
 namespace Go
 {
@@ -94,7 +95,8 @@ namespace Go
   /// Given a body in the volume model, return the index of this face
   int getIndex(shared_ptr<ftVolume> body) const;
 
-  /// Given a body in the volume model, return the index of this face
+  /// Given a body in the volume model, return the index of this face.
+  /// The lookup takes constant time unless the body is not found
   int getIndex(ftVolume* body) const;
 
   /// Return a specified body as a shared pointer
@@ -281,6 +283,9 @@ namespace Go
 
   double approxtol_;
 
+  /// Lookup table used in getIndex(), updated when the body set changes
+  std::unordered_map<const Body*, int> body_index_;
+
   /// Local storage of intersection results. Used internally in VolumeModel.
   typedef struct intersection_point 
   {
@@ -324,6 +329,10 @@ namespace Go
 
     void averageVolBoundaries(EdgeVertex* edge);
 
+    int bodyIndex(const Body* body) const;
+
+    void updateIndex();
+
 
   };
 